@@ -0,0 +1,116 @@
+#include <charconv>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Entries.h"
+#include "KSum.h"
+#include "Search.h"
+#include "Year2020.h"
+
+namespace aoc::y2020 {
+
+namespace {
+
+class Day01 : public Solution
+{
+public:
+    void parse(const Input& input) override
+    {
+        // Read and parse each number
+        parseEntries(input, m_numbers);
+
+        if (m_find == nullptr) {
+            m_kSum = std::make_unique<KSum>(m_numbers);
+        }
+    }
+
+    std::string part1() override
+    {
+        return std::to_string(findProduct(m_part1K));
+    }
+
+    std::string part2() override
+    {
+        return std::to_string(findProduct(m_part2K));
+    }
+
+    // goal=<n>, k1=<n>, k2=<n> change the target and how many entries each part adds up.
+    // search=brute switches from the k-sum index to the nested loop search,
+    // kernel=auto|scalar|avx2|avx512 picks its inner loop.
+    bool setOption(std::string_view key, std::string_view value) override
+    {
+        auto parse = [&](auto& target) {
+            return std::from_chars(value.data(), value.data() + value.size(), target).ec == std::errc();
+        };
+
+        if (key == "goal") {
+            return parse(m_goal);
+        }
+        if (key == "k1") {
+            return parse(m_part1K);
+        }
+        if (key == "k2") {
+            return parse(m_part2K);
+        }
+        if (key == "search") {
+            m_find = value == "brute" ? findKernel(m_kernel) : nullptr;
+            return value == "brute" || value == "index";
+        }
+        if (key == "kernel") {
+            if (!tryParseSimdLevel(value, m_kernel)) {
+                return false;
+            }
+            if (findKernel(m_kernel) == nullptr) {
+                throw std::runtime_error(std::string(value) + " is not supported on this CPU");
+            }
+            if (m_find != nullptr) {
+                m_find = findKernel(m_kernel);
+            }
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    // Product of the k entries that add up to the goal, 0 if there aren't any.
+    int64_t findProduct(int k) const
+    {
+        auto addends = m_find != nullptr
+            ? bruteForceKSum(m_numbers, m_goal, k, m_find)
+            : m_kSum->find(m_goal, k);
+        if (addends.empty()) {
+            return 0;
+        }
+
+        int64_t product = 1;
+        for (auto addend : addends) {
+            product *= addend;
+        }
+
+        return product;
+    }
+
+    int64_t m_goal = 2020;
+    int m_part1K = 2;
+    int m_part2K = 3;
+
+    SimdLevel m_kernel = SimdLevel::Auto;
+
+    // Set when using the brute force search instead of the index.
+    FindFn m_find = nullptr;
+
+    std::vector<int> m_numbers;
+    std::unique_ptr<KSum> m_kSum;
+};
+
+}
+
+std::unique_ptr<Solution> makeDay01()
+{
+    return std::make_unique<Day01>();
+}
+
+}
@@ -0,0 +1,60 @@
+#include "Entries.h"
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+
+namespace aoc::y2020 {
+
+namespace {
+
+template<typename T>
+bool tryParse(std::string_view line, T& value)
+{
+    auto end = line.data() + line.size();
+    auto result = std::from_chars(line.data(), end, value);
+    return !line.empty() && result.ec == std::errc() && result.ptr == end;
+}
+
+template<typename T>
+void parseAll(const Input& input, std::vector<T>& entries)
+{
+    entries.clear();
+    size_t lineNumber = 0;
+    for (auto line : input.lines()) {
+        ++lineNumber;
+        if (line.empty()) {
+            continue;
+        }
+
+        T value = 0;
+        if (!tryParse(line, value)) {
+            throw std::runtime_error("Bad entry on line " + std::to_string(lineNumber) + ": " + std::string(line));
+        }
+        entries.push_back(value);
+    }
+}
+
+}
+
+bool tryParseEntry(std::string_view line, int& value)
+{
+    return tryParse(line, value);
+}
+
+bool tryParseEntry(std::string_view line, int64_t& value)
+{
+    return tryParse(line, value);
+}
+
+void parseEntries(const Input& input, std::vector<int>& entries)
+{
+    parseAll(input, entries);
+}
+
+void parseEntries(const Input& input, std::vector<int64_t>& entries)
+{
+    parseAll(input, entries);
+}
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "Input.h"
+
+namespace aoc::y2020 {
+
+// One line of an expense report or goal list. False unless the whole line
+// is a number that fits.
+bool tryParseEntry(std::string_view line, int& value);
+bool tryParseEntry(std::string_view line, int64_t& value);
+
+// Every number in the input, in order, replacing what 'entries' held.
+// Blank lines are skipped, any other line that isn't a number throws
+// std::runtime_error naming its line number.
+void parseEntries(const Input& input, std::vector<int>& entries);
+void parseEntries(const Input& input, std::vector<int64_t>& entries);
+
+}
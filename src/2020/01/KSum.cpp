@@ -0,0 +1,238 @@
+#include "KSum.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace aoc::y2020 {
+
+namespace {
+
+// Widest value range we'll spend a bitmap on, 8MB per bitmap.
+constexpr int64_t maxBitmapRange = int64_t(1) << 26;
+
+// Most distinct pairs we'll walk to build the pair sum table, and the widest
+// range of sums it may cover (64MB).
+constexpr int64_t maxPairSums = int64_t(1) << 28;
+constexpr int64_t maxPairSumRange = int64_t(1) << 24;
+
+bool testBit(const std::vector<uint64_t>& bitmap, int64_t bit)
+{
+    return (bitmap[bit >> 6] >> (bit & 63)) & 1;
+}
+
+}
+
+KSum::KSum(std::vector<int> values)
+    : m_values(std::move(values))
+{
+    std::sort(m_values.begin(), m_values.end());
+    if (m_values.empty()) {
+        return;
+    }
+
+    for (auto value : m_values) {
+        if (m_distinct.empty() || m_distinct.back() != value) {
+            m_distinct.push_back(value);
+            m_counts.push_back(0);
+        }
+        ++m_counts.back();
+    }
+
+    m_min = m_values.front();
+    auto range = int64_t(m_values.back()) - m_min + 1;
+    if (range > maxBitmapRange) {
+        return;
+    }
+
+    m_present.assign((range + 63) / 64, 0);
+    m_repeated.assign((range + 63) / 64, 0);
+    for (auto value : m_values) {
+        auto bit = value - m_min;
+        auto mask = uint64_t(1) << (bit & 63);
+        m_repeated[bit >> 6] |= m_present[bit >> 6] & mask;
+        m_present[bit >> 6] |= mask;
+    }
+}
+
+std::vector<int> KSum::find(int64_t goal, int k) const
+{
+    std::vector<int> addends;
+    if (k <= 0) {
+        return addends;
+    }
+
+    bool found;
+    if (k == 2 && !m_present.empty()) {
+        found = findPairInBitmap(goal, addends);
+    } else if (k == 3 && !m_pairSums.empty()) {
+        found = findTripleInTable(goal, addends);
+    } else {
+        found = findK(goal, k, 0, m_values.size(), addends);
+    }
+
+    if (!found) {
+        addends.clear();
+    }
+
+    std::sort(addends.begin(), addends.end());
+    return addends;
+}
+
+bool KSum::findPairInBitmap(int64_t goal, std::vector<int>& addends) const
+{
+    auto bits = static_cast<int64_t>(m_present.size()) * 64;
+    for (auto value : m_distinct) {
+        // Values are sorted, past the halfway point every pair has been tried.
+        auto remaining = goal - value;
+        if (remaining < value) {
+            break;
+        }
+
+        auto bit = remaining - m_min;
+        if (bit >= bits) {
+            continue;
+        }
+
+        // The same entry can't be used twice.
+        if (testBit(remaining == value ? m_repeated : m_present, bit)) {
+            addends = { value, static_cast<int>(remaining) };
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool KSum::indexPairSums()
+{
+    auto distinct = static_cast<int64_t>(m_distinct.size());
+    auto range = distinct > 0 ? int64_t(m_distinct.back()) - m_min + 1 : 0;
+    if (m_present.empty() || distinct * distinct / 2 > maxPairSums || 2 * range - 1 > maxPairSumRange) {
+        return false;
+    }
+
+    // Larger addend in the outer loop, so the first pair to claim a sum has the smallest one.
+    m_pairSums.assign(2 * range - 1, -1);
+    for (int32_t high = 0; high < distinct; ++high) {
+        for (int32_t low = 0; low <= high; ++low) {
+            if (low == high && m_counts[high] < 2) {
+                break;
+            }
+
+            auto& slot = m_pairSums[int64_t(m_distinct[low]) + m_distinct[high] - 2 * m_min];
+            if (slot < 0) {
+                slot = low;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool KSum::findTripleInTable(int64_t goal, std::vector<int>& addends) const
+{
+    // Look for a <= b <= c with c taken from the values and a + b from the table.
+    for (size_t idx = 0; idx < m_distinct.size(); ++idx) {
+        auto c = m_distinct[idx];
+        auto slot = goal - c - 2 * m_min;
+        if (slot < 0) {
+            break;
+        }
+        if (slot >= static_cast<int64_t>(m_pairSums.size()) || m_pairSums[slot] < 0) {
+            continue;
+        }
+
+        // The stored pair has the smallest possible b, so if it doesn't fit under c nothing does.
+        auto a = m_distinct[m_pairSums[slot]];
+        auto b = static_cast<int>(goal - c - a);
+        if (b > c) {
+            continue;
+        }
+
+        // c has to be a separate entry from a and b.
+        auto needed = 1u + (b == c) + (a == c);
+        if (m_counts[idx] >= needed) {
+            addends = { a, b, c };
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool KSum::findPair(int64_t goal, size_t first, size_t last, std::vector<int>& addends) const
+{
+    if (last - first < 2) {
+        return false;
+    }
+
+    auto low = first;
+    auto high = last - 1;
+    while (low < high) {
+        auto sum = int64_t(m_values[low]) + m_values[high];
+        if (sum == goal) {
+            addends.push_back(m_values[low]);
+            addends.push_back(m_values[high]);
+            return true;
+        }
+
+        if (sum < goal) {
+            ++low;
+        } else {
+            --high;
+        }
+    }
+
+    return false;
+}
+
+bool KSum::findK(int64_t goal, int k, size_t first, size_t last, std::vector<int>& addends) const
+{
+    if (last - first < static_cast<size_t>(k)) {
+        return false;
+    }
+
+    if (k == 1) {
+        if (std::binary_search(m_values.begin() + first, m_values.begin() + last, goal)) {
+            addends.push_back(static_cast<int>(goal));
+            return true;
+        }
+        return false;
+    }
+
+    if (k == 2) {
+        return findPair(goal, first, last, addends);
+    }
+
+    // The k - 1 largest values, for skipping entries that can't reach the goal.
+    auto largest = std::accumulate(m_values.begin() + last - (k - 1), m_values.begin() + last, int64_t(0));
+
+    for (auto idx = first; idx + k <= last; ++idx) {
+        auto value = m_values[idx];
+
+        // A repeated value can only find what its first occurrence already tried.
+        if (idx > first && value == m_values[idx - 1]) {
+            continue;
+        }
+
+        // Everything from here on is at least this big, so the sums only grow.
+        auto smallest = std::accumulate(m_values.begin() + idx, m_values.begin() + idx + k, int64_t(0));
+        if (smallest > goal) {
+            break;
+        }
+
+        if (value + largest < goal) {
+            continue;
+        }
+
+        addends.push_back(value);
+        if (findK(goal - value, k - 1, idx + 1, last, addends)) {
+            return true;
+        }
+        addends.pop_back();
+    }
+
+    return false;
+}
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aoc::y2020 {
+
+/**
+ * Finds k entries of a list that add up to a goal.
+ *
+ * The values are sorted once up front. Pairs are found in O(n) with a
+ * presence bitmap over the value range (or a two pointer sweep when the
+ * range is too wide for one), triples in O(n^2) and k entries in O(n^(k-1)).
+ * Searches stop at the first match.
+ *
+ * When the same entries are queried for many goals, indexPairSums() trades
+ * a one-off O(d^2) build (d distinct values) for O(d) triple queries.
+ **/
+class KSum
+{
+public:
+    explicit KSum(std::vector<int> values);
+
+    // Returns the k addends in ascending order, or nothing if no k entries add up to goal.
+    std::vector<int> find(int64_t goal, int k) const;
+
+    // Records one pair for every reachable pair sum. Returns false, leaving
+    // triple queries on the O(n^2) search, if the table would be too big.
+    bool indexPairSums();
+
+    const std::vector<int>& values() const { return m_values; }
+
+private:
+    // Search within m_values[first, last).
+    bool findPair(int64_t goal, size_t first, size_t last, std::vector<int>& addends) const;
+    bool findK(int64_t goal, int k, size_t first, size_t last, std::vector<int>& addends) const;
+    bool findPairInBitmap(int64_t goal, std::vector<int>& addends) const;
+    bool findTripleInTable(int64_t goal, std::vector<int>& addends) const;
+
+    std::vector<int> m_values;
+
+    // Each value once, in order, and how many times it appears.
+    std::vector<int> m_distinct;
+    std::vector<uint32_t> m_counts;
+
+    // One bit per value in [m_min, m_min + range), plus a second bitmap for values seen twice.
+    int64_t m_min = 0;
+    std::vector<uint64_t> m_present;
+    std::vector<uint64_t> m_repeated;
+
+    // Indexed by sum - 2 * m_min. Holds the index into m_distinct of the
+    // smaller addend of the pair whose larger addend is smallest, or -1.
+    std::vector<int32_t> m_pairSums;
+};
+
+}
@@ -0,0 +1,77 @@
+#include "OnlineKSum.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace aoc::y2020 {
+
+namespace {
+
+// Checked before any table is sized from it.
+int checkGoal(int goal)
+{
+    if (goal < 0) {
+        throw std::invalid_argument("Goal " + std::to_string(goal) + " is negative");
+    }
+    return goal;
+}
+
+}
+
+OnlineKSum::OnlineKSum(int goal)
+    : m_goal(checkGoal(goal))
+    , m_seen(size_t(m_goal) + 1, false)
+    , m_seenTwice(size_t(m_goal) + 1, false)
+    , m_pairAddend(size_t(m_goal) + 1, -1)
+{}
+
+bool OnlineKSum::add(int value)
+{
+    ++m_entries;
+    if (value < 0 || value > m_goal || done()) {
+        return false;
+    }
+
+    auto completed = false;
+    auto remaining = m_goal - value;
+
+    if (!hasPair() && m_seen[remaining]) {
+        m_pair[0] = remaining;
+        m_pair[1] = value;
+        completed = true;
+    }
+
+    if (!hasTriple() && m_pairAddend[remaining] >= 0) {
+        m_triple[0] = m_pairAddend[remaining];
+        m_triple[1] = remaining - m_pairAddend[remaining];
+        m_triple[2] = value;
+        completed = true;
+    }
+
+    // Record the sums this entry makes with everything before it. A repeat
+    // only adds value + value, the rest were recorded the first time round.
+    if (!hasTriple()) {
+        if (m_seen[value]) {
+            if (!m_seenTwice[value] && value <= remaining && m_pairAddend[value + value] < 0) {
+                m_pairAddend[value + value] = value;
+            }
+        } else {
+            for (auto other : m_distinct) {
+                if (other <= remaining && m_pairAddend[other + value] < 0) {
+                    m_pairAddend[other + value] = other;
+                }
+            }
+        }
+    }
+
+    if (m_seen[value]) {
+        m_seenTwice[value] = true;
+    } else {
+        m_seen[value] = true;
+        m_distinct.push_back(value);
+    }
+
+    return completed;
+}
+
+}
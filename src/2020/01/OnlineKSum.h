@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aoc::y2020 {
+
+/**
+ * Answers the Day 1 pair and triple questions while entries are still arriving.
+ *
+ * Keeps a bitmap of the values seen so far and, for every sum reachable by
+ * two of them, one pair that makes it. A new entry completes a pair if its
+ * complement has been seen and a triple if some earlier pair makes up the
+ * rest. Only values between 0 and the goal can be part of an answer, so
+ * memory is O(goal) however long the stream runs.
+ **/
+class OnlineKSum
+{
+public:
+    // Throws std::invalid_argument if the goal is negative.
+    explicit OnlineKSum(int goal);
+
+    // Returns true if this entry completed the first pair or triple.
+    bool add(int value);
+
+    bool hasPair() const { return m_pair[0] >= 0; }
+    bool hasTriple() const { return m_triple[0] >= 0; }
+    bool done() const { return hasPair() && hasTriple(); }
+
+    // Product of the addends, only valid once found.
+    int64_t pairProduct() const { return int64_t(m_pair[0]) * m_pair[1]; }
+    int64_t tripleProduct() const { return int64_t(m_triple[0]) * m_triple[1] * m_triple[2]; }
+
+    size_t entries() const { return m_entries; }
+
+private:
+    int m_goal;
+    size_t m_entries = 0;
+
+    // Seen once and seen at least twice, indexed by value.
+    std::vector<bool> m_seen;
+    std::vector<bool> m_seenTwice;
+
+    // Values seen so far, each listed once.
+    std::vector<int> m_distinct;
+
+    // For each sum, one addend of a pair of earlier entries adding up to it, or -1.
+    std::vector<int> m_pairAddend;
+
+    int m_pair[2] = { -1, -1 };
+    int m_triple[3] = { -1, -1, -1 };
+};
+
+}
@@ -0,0 +1,126 @@
+#include "Search.h"
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace aoc::y2020 {
+
+namespace {
+
+size_t findScalar(const int* data, size_t count, int value)
+{
+    for (size_t idx = 0; idx < count; ++idx) {
+        if (data[idx] == value) {
+            return idx;
+        }
+    }
+
+    return count;
+}
+
+#if AOC_X86_64
+
+AOC_TARGET("avx2")
+size_t findAvx2(const int* data, size_t count, int value)
+{
+    auto needle = _mm256_set1_epi32(value);
+    size_t idx = 0;
+
+    // Two vectors per iteration so the compares overlap.
+    for (; idx + 16 <= count; idx += 16) {
+        auto lo = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + idx)), needle);
+        auto hi = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + idx + 8)), needle);
+        auto mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(lo)))
+            | static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(hi))) << 8;
+        if (mask != 0) {
+            return idx + std::countr_zero(static_cast<uint32_t>(mask));
+        }
+    }
+
+    for (; idx + 8 <= count; idx += 8) {
+        auto match = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + idx)), needle);
+        auto mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(match)));
+        if (mask != 0) {
+            return idx + std::countr_zero(static_cast<uint32_t>(mask));
+        }
+    }
+
+    return idx + findScalar(data + idx, count - idx, value);
+}
+
+AOC_TARGET("avx512f,avx512bw")
+size_t findAvx512(const int* data, size_t count, int value)
+{
+    auto needle = _mm512_set1_epi32(value);
+    size_t idx = 0;
+    for (; idx + 16 <= count; idx += 16) {
+        auto mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + idx), needle);
+        if (mask != 0) {
+            return idx + std::countr_zero(static_cast<uint32_t>(mask));
+        }
+    }
+
+    // Masked load for the tail, lanes past the end never match.
+    auto tail = static_cast<__mmask16>((1u << (count - idx)) - 1);
+    auto mask = _mm512_mask_cmpeq_epi32_mask(tail, _mm512_maskz_loadu_epi32(tail, data + idx), needle);
+    return mask != 0 ? idx + std::countr_zero(static_cast<uint32_t>(mask)) : count;
+}
+
+#endif
+
+bool bruteForce(const std::vector<int>& values, size_t first, int64_t goal, int k, FindFn find, std::vector<int>& addends)
+{
+    if (k == 1) {
+        if (goal < std::numeric_limits<int>::min() || goal > std::numeric_limits<int>::max()) {
+            return false;
+        }
+
+        auto idx = first + find(values.data() + first, values.size() - first, static_cast<int>(goal));
+        if (idx == values.size()) {
+            return false;
+        }
+
+        addends.push_back(values[idx]);
+        return true;
+    }
+
+    for (auto idx = first; idx + k <= values.size(); ++idx) {
+        addends.push_back(values[idx]);
+        if (bruteForce(values, idx + 1, goal - values[idx], k - 1, find, addends)) {
+            return true;
+        }
+        addends.pop_back();
+    }
+
+    return false;
+}
+
+}
+
+FindFn findKernel(SimdLevel level)
+{
+    if (!resolveSimdLevel(level)) {
+        return nullptr;
+    }
+
+    switch (level) {
+#if AOC_X86_64
+    case SimdLevel::Avx2: return findAvx2;
+    case SimdLevel::Avx512: return findAvx512;
+#endif
+    default: return findScalar;
+    }
+}
+
+std::vector<int> bruteForceKSum(const std::vector<int>& values, int64_t goal, int k, FindFn find)
+{
+    std::vector<int> addends;
+    if (k <= 0 || !bruteForce(values, 0, goal, k, find, addends)) {
+        addends.clear();
+    }
+
+    return addends;
+}
+
+}
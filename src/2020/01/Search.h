@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Simd.h"
+
+namespace aoc::y2020 {
+
+/**
+ * Brute force k-sum over the entries in their original order.
+ *
+ * This is the nested loop search, with the innermost "is the remaining value
+ * anywhere after this entry" scan done by a linear search kernel. The kernels
+ * compare 8 (AVX2) or 16 (AVX-512) entries per instruction, and Auto picks
+ * the widest one the CPU supports.
+ **/
+
+// Index of the first entry equal to value, or count if there isn't one.
+using FindFn = size_t (*)(const int* data, size_t count, int value);
+
+// Returns null if the CPU doesn't support the kernel.
+FindFn findKernel(SimdLevel level);
+
+// Returns the k addends in the order they appear, or nothing.
+std::vector<int> bruteForceKSum(const std::vector<int>& values, int64_t goal, int k, FindFn find);
+
+}
@@ -0,0 +1,88 @@
+/**
+ * Day 1 over a live stream, answering as soon as the entries allow.
+ *
+ *   2020_01_online [file] [--goal <n>]
+ *
+ * Reads stdin unless given a file, and exits as soon as both answers are known.
+ *
+ * The times printed are latencies, from start up to the entry that settled
+ * each answer, on one pass over a stream that can't be replayed. Per-day phase
+ * timings come from the runner's Benchmark, not from this tool.
+ **/
+#include <chrono>
+#include <charconv>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "Entries.h"
+#include "LineStream.h"
+#include "OnlineKSum.h"
+
+int main(int argc, char** argv)
+{
+    std::string path = "-";
+    auto goal = 2020;
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg = argv[idx];
+        if (arg == "--goal" && idx + 1 < argc) {
+            std::string_view value = argv[++idx];
+            auto end = value.data() + value.size();
+            auto result = std::from_chars(value.data(), end, goal);
+            if (value.empty() || result.ec != std::errc() || result.ptr != end || goal < 0) {
+                std::cerr << "Error: --goal must be a number of at least 0" << std::endl;
+                return 1;
+            }
+        } else {
+            path = arg;
+        }
+    }
+
+    try {
+        auto start = std::chrono::steady_clock::now();
+        auto report = [&](const char* part, int64_t answer, size_t entries) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << part << ": " << answer << " (after " << entries << " entries, " << elapsed << "us)" << std::endl;
+        };
+
+        aoc::LineStream stream(path);
+        aoc::y2020::OnlineKSum online(goal);
+        std::string_view line;
+        while (!online.done() && stream.next(line)) {
+            auto hadPair = online.hasPair();
+            auto hadTriple = online.hasTriple();
+            if (line.empty()) {
+                continue;
+            }
+
+            int value = 0;
+            if (!aoc::y2020::tryParseEntry(line, value)) {
+                throw std::runtime_error("Bad entry: " + std::string(line));
+            }
+            if (!online.add(value)) {
+                continue;
+            }
+
+            if (!hadPair && online.hasPair()) {
+                report("Part1", online.pairProduct(), online.entries());
+            }
+            if (!hadTriple && online.hasTriple()) {
+                report("Part2", online.tripleProduct(), online.entries());
+            }
+        }
+
+        if (!online.hasPair()) {
+            std::cout << "Part1: no pair adds up to " << goal << std::endl;
+        }
+        if (!online.hasTriple()) {
+            std::cout << "Part2: no triple adds up to " << goal << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/**
+ * Answers many Day 1 goals against one expense report.
+ *
+ *   2020_01_query <input> [--k <k>[,<k>...]] [--goals <file>] [--range <lo>-<hi>] [--print]
+ *
+ * Goals come from a file (one per line) and/or a range, the default is every
+ * goal from 0 to 4040. The index is built once, then every goal is queried
+ * for every k (default: 2) and the throughput of each k reported, so pair and
+ * triple queries share one index. --print also lists each goal's product.
+ **/
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "DayList.h"
+#include "Entries.h"
+#include "Input.h"
+#include "KSum.h"
+
+namespace {
+
+void printUsage(std::ostream& out)
+{
+    out << "Usage: 2020_01_query <input> [--k <k>[,<k>...]] [--goals <file>] [--range <lo>-<hi>] [--print]" << std::endl;
+}
+
+// "2,3" into { 2, 3 }.
+std::vector<int> parseKs(const std::string& spec)
+{
+    std::vector<int> ks;
+    std::string_view rest(spec);
+    for (;;) {
+        auto comma = rest.find(',');
+        ks.push_back(static_cast<int>(aoc::parseCount("--k", std::string(rest.substr(0, comma)), 1)));
+        if (comma == std::string_view::npos) {
+            return ks;
+        }
+        rest.remove_prefix(comma + 1);
+    }
+}
+
+// Appends every goal from lo to hi, either may be negative.
+void addRange(const std::string& range, std::vector<int64_t>& goals)
+{
+    auto dash = range.find('-', 1);
+    int64_t first = 0;
+    int64_t last = 0;
+    if (dash == std::string::npos
+        || !aoc::y2020::tryParseEntry(std::string_view(range).substr(0, dash), first)
+        || !aoc::y2020::tryParseEntry(std::string_view(range).substr(dash + 1), last)
+        || first > last) {
+        throw std::invalid_argument("Bad --range \"" + range + "\", expected <lo>-<hi>");
+    }
+
+    for (auto goal = first; goal <= last; ++goal) {
+        goals.push_back(goal);
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    try {
+        std::string inputFile;
+        std::vector<int> ks;
+        auto print = false;
+        std::vector<int64_t> goals;
+        for (auto idx = 1; idx < argc; ++idx) {
+            std::string arg = argv[idx];
+            if (arg == "--help" || arg == "-h") {
+                printUsage(std::cout);
+                return 0;
+            } else if (arg == "--k" && idx + 1 < argc) {
+                auto more = parseKs(argv[++idx]);
+                ks.insert(ks.end(), more.begin(), more.end());
+            } else if (arg == "--goals" && idx + 1 < argc) {
+                std::vector<int64_t> fromFile;
+                aoc::y2020::parseEntries(aoc::Input::open(argv[++idx]), fromFile);
+                goals.insert(goals.end(), fromFile.begin(), fromFile.end());
+            } else if (arg == "--range" && idx + 1 < argc) {
+                addRange(argv[++idx], goals);
+            } else if (arg == "--print") {
+                print = true;
+            } else if (arg.starts_with("-") || !inputFile.empty()) {
+                // Unknown options, options missing their value and a second input.
+                std::cerr << "Unexpected argument " << arg << "." << std::endl << std::endl;
+                printUsage(std::cerr);
+                return 1;
+            } else {
+                inputFile = std::move(arg);
+            }
+        }
+
+        if (inputFile.empty()) {
+            printUsage(std::cerr);
+            return 1;
+        }
+
+        if (ks.empty()) {
+            ks.push_back(2);
+        }
+
+        if (goals.empty()) {
+            for (auto goal = 0; goal <= 4040; ++goal) {
+                goals.push_back(goal);
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        auto input = aoc::Input::open(inputFile);
+        std::vector<int> numbers;
+        aoc::y2020::parseEntries(input, numbers);
+
+        aoc::y2020::KSum index(std::move(numbers));
+        auto tabled = std::find(ks.begin(), ks.end(), 3) != ks.end() && index.indexPairSums();
+
+        auto built = std::chrono::steady_clock::now();
+        auto build = std::chrono::duration_cast<std::chrono::microseconds>(built - start).count();
+        std::cout
+            << "Index: " << index.values().size() << " entries" << (tabled ? " + pair sum table" : "")
+            << " (" << build << "us)" << std::endl;
+
+        for (auto k : ks) {
+            auto t1 = std::chrono::steady_clock::now();
+
+            size_t found = 0;
+            std::vector<int64_t> products(goals.size(), 0);
+            for (size_t idx = 0; idx < goals.size(); ++idx) {
+                auto addends = index.find(goals[idx], k);
+                if (addends.empty()) {
+                    continue;
+                }
+
+                ++found;
+                products[idx] = 1;
+                for (auto addend : addends) {
+                    products[idx] *= addend;
+                }
+            }
+
+            auto t2 = std::chrono::steady_clock::now();
+
+            if (print) {
+                for (size_t idx = 0; idx < goals.size(); ++idx) {
+                    std::cout << goals[idx] << " (k = " << k << "): " << products[idx] << std::endl;
+                }
+            }
+
+            auto query = std::chrono::duration<double>(t2 - t1).count();
+            std::cout
+                << "Queries: " << goals.size() << " goals, k = " << k << ", " << found << " answered"
+                << " (" << static_cast<int64_t>(query * 1e6) << "us)" << std::endl
+                << "Throughput: " << static_cast<int64_t>(goals.size() / std::max(query, 1e-9)) << " queries/s" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+/**
+ * --- Day 2: Password Philosophy ---
+ * Your flight departs in a few days from the coastal airport; the easiest way down to the coast from here is via toboggan.
+ * 
+ * The shopkeeper at the North Pole Toboggan Rental Shop is having a bad day. "Something's wrong with our computers; we can't log in!" You ask if you can take a look.
+ * 
+ * Their password database seems to be a little corrupted: some of the passwords wouldn't have been allowed by the Official Toboggan Corporate Policy that was in effect when they were chosen.
+ * 
+ * To try to debug the problem, they have created a list (your puzzle input) of passwords (according to the corrupted database) and the corporate policy when that password was set.
+ * 
+ * For example, suppose you have the following list:
+ * 
+ * 1-3 a: abcde
+ * 1-3 b: cdefg
+ * 2-9 c: ccccccccc
+ * Each line gives the password policy and then the password. The password policy indicates the lowest and highest number of times a given letter must appear for the password to be valid. For example, 1-3 a means that the password must contain a at least 1 time and at most 3 times.
+ * 
+ * In the above example, 2 passwords are valid. The middle password, cdefg, is not; it contains no instances of b, but needs at least 1. The first and third passwords are valid: they contain one a or nine c, both within the limits of their respective policies.
+ * 
+ * How many passwords are valid according to their policies?
+ * 
+ * --- Part Two ---
+ * While it appears you validated the passwords correctly, they don't seem to be what the Official Toboggan Corporate Authentication System is expecting.
+ * 
+ * The shopkeeper suddenly realizes that he just accidentally explained the password policy rules from his old job at the sled rental place down the street! The Official Toboggan Corporate Policy actually works a little differently.
+ * 
+ * Each policy actually describes two positions in the password, where 1 means the first character, 2 means the second character, and so on. (Be careful; Toboggan Corporate Policies have no concept of "index zero"!) Exactly one of these positions must contain the given letter. Other occurrences of the letter are irrelevant for the purposes of policy enforcement.
+ * 
+ * Given the same example list from above:
+ * 
+ * 1-3 a: abcde is valid: position 1 contains a and position 3 does not.
+ * 1-3 b: cdefg is invalid: neither position 1 nor position 3 contains b.
+ * 2-9 c: ccccccccc is invalid: both position 2 and position 9 contain c.
+ * How many passwords are valid according to the new interpretation of the policies?
+ **/
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Parallel.h"
+#include "Passwords.h"
+#include "Year2020.h"
+
+namespace aoc::y2020 {
+
+namespace {
+
+// Entries parsed per batch in the threaded pass, small enough that the
+// table is still in cache when it's validated.
+constexpr size_t batchSize = 4096;
+
+struct Counts
+{
+    size_t part1 = 0;
+    size_t part2 = 0;
+};
+
+class Day02 : public Solution
+{
+public:
+    void parse(const Input& input) override
+    {
+        m_buffer = input.data();
+        m_table.clear();
+        if (m_threads >= 0) {
+            parseAndValidate();
+            return;
+        }
+
+        for (auto line : input.lines()) {
+            Entry entry;
+            if (tryParseEntry(line, m_buffer.data(), entry)) {
+                m_table.add(entry);
+            }
+        }
+    }
+
+    std::string part1() override
+    {
+        if (m_threads >= 0) {
+            return std::to_string(m_counts.part1);
+        }
+
+        auto p1Answer = m_table.countValidPart1(m_buffer, m_kernel);
+        if (m_verify) {
+            check(p1Answer, m_table.countValidPart1(m_buffer, SimdLevel::Scalar));
+        }
+
+        return std::to_string(p1Answer);
+    }
+
+    std::string part2() override
+    {
+        if (m_threads >= 0) {
+            return std::to_string(m_counts.part2);
+        }
+
+        auto p2Answer = m_table.countValidPart2(m_buffer, m_kernel);
+        if (m_verify) {
+            check(p2Answer, m_table.countValidPart2(m_buffer, SimdLevel::Scalar));
+        }
+
+        return std::to_string(p2Answer);
+    }
+
+    // The password columns, mapped back in as they are. The fused pass
+    // keeps nothing worth saving.
+    uint32_t cacheVersion() const override
+    {
+        return m_threads >= 0 ? 0 : 1;
+    }
+
+    void saveParsed(ParseCacheWriter& cache) const override
+    {
+        m_table.save(cache);
+    }
+
+    void loadParsed(const ParseCache& cache, const Input& input) override
+    {
+        m_buffer = input.data();
+        m_table.map(cache, 0);
+    }
+
+    // kernel=auto|scalar|avx2|avx512 picks the validation kernels,
+    // verify=1 checks every answer against the scalar validators.
+    // threads=<n> parses and validates in one pass over n chunks of the
+    // input, one thread each (0 for one per core), and keeps no entries.
+    bool setOption(std::string_view key, std::string_view value) override
+    {
+        if (key == "kernel") {
+            if (!tryParseSimdLevel(value, m_kernel)) {
+                return false;
+            }
+            auto resolved = m_kernel;
+            if (!resolveSimdLevel(resolved)) {
+                throw std::runtime_error(std::string(value) + " is not supported on this CPU");
+            }
+            return true;
+        }
+        if (key == "threads") {
+            // The whole value, so "3abc" isn't taken as 3.
+            auto threads = 0;
+            auto end = value.data() + value.size();
+            auto result = std::from_chars(value.data(), end, threads);
+            if (value.empty() || result.ec != std::errc() || result.ptr != end || threads < 0) {
+                return false;
+            }
+            m_threads = threads;
+            return true;
+        }
+        if (key == "verify") {
+            m_verify = value != "0";
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    void parseAndValidate()
+    {
+        auto chunks = splitAtNewlines(m_buffer, m_threads > 0 ? m_threads : hardwareThreads());
+        std::vector<Counts> chunkCounts(chunks.size());
+        parallelFor(chunks.size(), [&](size_t idx) {
+            PasswordTable batch;
+            auto& counts = chunkCounts[idx];
+            auto validate = [&] {
+                auto part1 = batch.countValidPart1(m_buffer, m_kernel);
+                auto part2 = batch.countValidPart2(m_buffer, m_kernel);
+                if (m_verify) {
+                    check(part1, batch.countValidPart1(m_buffer, SimdLevel::Scalar));
+                    check(part2, batch.countValidPart2(m_buffer, SimdLevel::Scalar));
+                }
+
+                counts.part1 += part1;
+                counts.part2 += part2;
+                batch.clear();
+            };
+
+            for (auto line : LineRange(chunks[idx], false)) {
+                Entry entry;
+                if (tryParseEntry(line, m_buffer.data(), entry)) {
+                    batch.add(entry);
+                    if (batch.size() == batchSize) {
+                        validate();
+                    }
+                }
+            }
+            validate();
+        });
+
+        m_counts = Counts();
+        for (const auto& counts : chunkCounts) {
+            m_counts.part1 += counts.part1;
+            m_counts.part2 += counts.part2;
+        }
+    }
+
+    static void check(size_t answer, size_t expected)
+    {
+        if (answer != expected) {
+            throw std::runtime_error(
+                "Kernel counted " + std::to_string(answer) + " valid passwords, scalar counted " + std::to_string(expected));
+        }
+    }
+
+    SimdLevel m_kernel = SimdLevel::Auto;
+    bool m_verify = false;
+
+    // Worker threads for the fused pass, -1 to keep the table and validate in part1/part2.
+    int m_threads = -1;
+    Counts m_counts;
+
+    std::string_view m_buffer;
+    PasswordTable m_table;
+};
+
+}
+
+std::unique_ptr<Solution> makeDay02()
+{
+    return std::make_unique<Day02>();
+}
+
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "ParseCache.h"
+#include "Simd.h"
+
+namespace aoc::y2020 {
+
+// One line of the input. The password stays in the input buffer.
+struct Entry
+{
+    uint64_t offset;
+    uint16_t length;
+    uint16_t pos1;
+    uint16_t pos2;
+    char letter;
+
+    std::string_view password(const char* buffer) const { return std::string_view(buffer + offset, length); }
+};
+
+bool tryParseEntry(std::string_view input, const char* buffer, Entry& entry);
+
+bool validatePasswordPart1(const Entry& entry, const char* buffer);
+bool validatePasswordPart2(const Entry& entry, const char* buffer);
+
+/**
+ * The entries stored column by column.
+ *
+ * Kernels load the policy fields of 4 (AVX2) or 8 (AVX-512) entries with one
+ * instruction each. Part 1 counts the letter in 32 password bytes per
+ * compare, Part 2 gathers the byte at both positions of a whole block of
+ * entries at once. Offsets must be ascending, as they are when the entries
+ * are added in input order.
+ *
+ * The columns can be saved to a ParseCache and used straight from the
+ * mapped file later, no copies made.
+ **/
+class PasswordTable
+{
+public:
+    // Also lets go of mapped columns.
+    void clear();
+
+    // Throws std::logic_error while the columns are mapped, clear() first.
+    void add(const Entry& entry);
+
+    size_t size() const { return columns().offsets.size(); }
+    Entry operator[](size_t idx) const;
+
+    // Adds the columns to a cache as five sections.
+    void save(ParseCacheWriter& cache) const;
+
+    // Reads the columns in place from the five sections starting at
+    // 'first', until the next clear(). Throws std::runtime_error if they
+    // don't all have the same length.
+    void map(const ParseCache& cache, size_t first);
+
+    // Number of entries passing each policy. buffer is the whole input the
+    // offsets point into, kernels never read past its end.
+    size_t countValidPart1(std::string_view buffer, SimdLevel level) const;
+    size_t countValidPart2(std::string_view buffer, SimdLevel level) const;
+
+private:
+    struct ColumnSpans
+    {
+        std::span<const uint64_t> offsets;
+        std::span<const uint16_t> lengths;
+        std::span<const uint16_t> pos1;
+        std::span<const uint16_t> pos2;
+        std::span<const char> letters;
+    };
+
+    // The mapped columns if there are any, the vectors otherwise.
+    ColumnSpans columns() const
+    {
+        return m_mapped ? *m_mapped : ColumnSpans{ m_offsets, m_lengths, m_pos1, m_pos2, m_letters };
+    }
+
+    std::optional<ColumnSpans> m_mapped;
+    std::vector<uint64_t> m_offsets;
+    std::vector<uint16_t> m_lengths;
+    std::vector<uint16_t> m_pos1;
+    std::vector<uint16_t> m_pos2;
+    std::vector<char> m_letters;
+};
+
+}
@@ -86,97 +86,94 @@
  * each of the listed slopes?
  **/
 
-#include <chrono>
-#include <fstream>
-#include <iostream>
+#include <charconv>
+#include <memory>
 #include <string>
 #include <vector>
 
-class Map
+#include "GridView.h"
+#include "Parallel.h"
+#include "Product.h"
+#include "TreeMap.h"
+#include "Year2020.h"
+
+namespace aoc::y2020 {
+
+namespace {
+
+class Day03 : public Solution
 {
 public:
-    Map(std::unique_ptr<std::vector<std::string>> data)
-        : m_width(data->at(0).length())
-        , m_height(data->size())
-        , m_data(std::move(data))
-        , m_x(0)
-        , m_y(0)
-    {}
-
-    size_t countTrees(size_t dx, size_t dy)
+    void parse(const Input& input) override
     {
-        reset();
+        // Validates the layout, nothing is copied.
+        m_grid = std::make_unique<GridView>(input.data());
+        m_map = m_packed ? std::make_unique<TreeMap>(*m_grid) : nullptr;
+    }
 
-        size_t trees = 0;
-        while (m_y < m_height - 1) {
-            trees += move(dx, dy);
-        }
-        
-        return trees;
+    std::string part1() override
+    {
+        return std::to_string(countTrees({ { 3, 1 } }, 1).front());
     }
 
-private:
-    void reset() { m_x = 0; m_y = 0; }
+    std::string part2() override
+    {
+        // All the slopes in one sweep down the map per thread. With enough
+        // slopes the product won't fit in 64 bits.
+        auto trees = countTrees(m_slopes, m_threads > 0 ? m_threads : hardwareThreads());
+        return exactProduct(std::vector<uint64_t>(trees.begin(), trees.end()));
+    }
 
-    // returns true if new position is on a tree
-    bool move(int dx, int dy)
+    // slopes=<file> replaces the Part 2 slopes with the ones listed in the
+    // file, see parseSlopes(). threads=<n> spreads them over n threads (0
+    // for one per core). map=packed copies the grid into a bitmap first,
+    // which pays off for many slopes over a tall map.
+    bool setOption(std::string_view key, std::string_view value) override
     {
-        m_x = (m_x + dx) % m_width;
-        m_y = m_y + dy;
-        if (m_y >= m_height) {
-            m_y = m_height - 1;
+        if (key == "slopes") {
+            m_slopes = parseSlopes(Input::open(std::string(value)).data());
+            return true;
+        }
+        if (key == "map") {
+            m_packed = value == "packed";
+            return value == "packed" || value == "view";
+        }
+        if (key == "threads") {
+            // The whole value, so "3abc" isn't taken as 3.
+            size_t threads = 0;
+            auto end = value.data() + value.size();
+            auto result = std::from_chars(value.data(), end, threads);
+            if (value.empty() || result.ec != std::errc() || result.ptr != end) {
+                return false;
+            }
+            m_threads = threads;
+            return true;
         }
 
-        return m_data->at(m_y).at(m_x) == '#';
+        return false;
     }
 
-    const size_t m_width;    // wrap width
-    const size_t m_height;
-    size_t m_x;
-    size_t m_y;
-    std::unique_ptr<std::vector<std::string>> m_data;
-};
-
-int main(int argc, char** argv)
-{
-    auto start = std::chrono::high_resolution_clock::now();
-
-    // Read file
-    std::ifstream inputFile("input.txt");
-    std::string line;
-    auto data = std::make_unique<std::vector<std::string>>();
-    while (std::getline(inputFile, line)) {
-        data->push_back(std::move(line));
+private:
+    std::vector<size_t> countTrees(const std::vector<Slope>& slopes, size_t threads) const
+    {
+        return m_map ? m_map->countTrees(slopes, threads) : m_grid->countTrees(slopes, threads);
     }
-    inputFile.close();
-
-    auto t1 = std::chrono::high_resolution_clock::now();
-
-    // Part 1
-    Map map(std::move(data));
-    auto p1Answer = map.countTrees(3, 1);
 
-    auto t2 = std::chrono::high_resolution_clock::now();
+    std::vector<Slope> m_slopes = { { 1, 1 }, { 3, 1 }, { 5, 1 }, { 7, 1 }, { 1, 2 } };
+    size_t m_threads = 1;
+    bool m_packed = false;
 
-    // Part 2
-    auto p2Answer = map.countTrees(1, 1)
-        * p1Answer
-        * map.countTrees(5, 1)
-        * map.countTrees(7, 1)
-        * map.countTrees(1, 2);
+    std::unique_ptr<GridView> m_grid;
 
+    // Only built for map=packed.
+    std::unique_ptr<TreeMap> m_map;
+};
 
-    auto t3 = std::chrono::high_resolution_clock::now();
+}
 
-    auto fileLoad = std::chrono::duration_cast<std::chrono::microseconds>(t1 - start).count();
-    auto p1duration = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
-    auto p2duration = std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count();
-    auto totalTime = std::chrono::duration_cast<std::chrono::microseconds>(t3 - start).count();
+std::unique_ptr<Solution> makeDay03()
+{
+    return std::make_unique<Day03>();
+}
 
-    std::cout
-        << std::endl
-        << "File Load: " << fileLoad << "us" << std::endl
-        << "Part1: " << p1Answer << " (" << p1duration << "us)" << std::endl
-        << "Part2: " << p2Answer << " (" << p2duration << "us)" << std::endl
-        << "Total Time: " << totalTime << "us" << std::endl;
-}
\ No newline at end of file
+}
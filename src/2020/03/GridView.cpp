@@ -0,0 +1,52 @@
+#include "GridView.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace aoc::y2020 {
+
+GridView::GridView(std::string_view buffer)
+    : m_data(buffer.data())
+{
+    if (buffer.empty()) {
+        return;
+    }
+
+    // The first line fixes the width and the line ending for the rest.
+    auto newline = buffer.find('\n');
+    if (newline == std::string_view::npos) {
+        m_width = buffer.size();
+        m_height = 1;
+        m_stride = m_width;
+        return;
+    }
+
+    auto crlf = newline > 0 && buffer[newline - 1] == '\r';
+    m_width = newline - crlf;
+    m_stride = newline + 1;
+
+    // Check one line ending per row, the cells in between are never looked at.
+    auto badRow = [&](size_t start) {
+        auto end = std::min(buffer.find('\n', start), buffer.size());
+        auto actual = end - start - (end > start && buffer[end - 1] == '\r');
+        return std::runtime_error(
+            "Row " + std::to_string(m_height + 1) + " is " + std::to_string(actual)
+            + " wide, expected " + std::to_string(m_width));
+    };
+
+    for (size_t start = 0; start < buffer.size(); start += m_stride) {
+        auto remaining = buffer.size() - start;
+        if (remaining >= m_stride) {
+            if (buffer[start + m_stride - 1] != '\n' || (crlf && buffer[start + m_width] != '\r')) {
+                throw badRow(start);
+            }
+        } else if (remaining != m_width && !(crlf && remaining == m_width + 1 && buffer.back() == '\r')) {
+            // The last row may be missing its line ending, but nothing else.
+            throw badRow(start);
+        }
+        ++m_height;
+    }
+}
+
+}
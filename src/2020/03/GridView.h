@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "Slopes.h"
+
+namespace aoc::y2020 {
+
+/**
+ * The tree grid read in place from the input buffer.
+ *
+ * Every row of a fixed-width grid starts exactly one stride after the one
+ * above it (width plus the "\n" or "\r\n" line ending), so a cell is
+ * data[y * stride + x] and nothing needs to be copied. The buffer has to
+ * outlive the view.
+ *
+ * The layout is checked once on construction, one line ending per row, so
+ * the lookups themselves don't need any checks.
+ **/
+class GridView
+{
+public:
+    // Throws std::runtime_error if the rows aren't all the same width or
+    // don't all use the same line ending.
+    explicit GridView(std::string_view buffer);
+
+    size_t width() const { return m_width; }
+    size_t height() const { return m_height; }
+    size_t stride() const { return m_stride; }
+
+    const char* row(size_t y) const { return m_data + y * m_stride; }
+    bool isTree(size_t x, size_t y) const { return m_data[y * m_stride + x] == '#'; }
+
+    std::vector<size_t> countTrees(const std::vector<Slope>& slopes, size_t threads = 1) const
+    {
+        return countTreesOn(*this, slopes, threads);
+    }
+    size_t countTrees(Slope slope) const { return countTrees(std::vector<Slope>{ slope }).front(); }
+
+private:
+    const char* m_data = nullptr;
+    size_t m_width = 0;
+    size_t m_height = 0;
+    size_t m_stride = 0;
+};
+
+}
@@ -0,0 +1,53 @@
+#include "Slopes.h"
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+
+#include "Input.h"
+
+namespace aoc::y2020 {
+
+std::vector<Slope> parseSlopes(std::string_view text)
+{
+    std::vector<Slope> slopes;
+    size_t lineNumber = 0;
+    for (auto line : LineRange(text, false)) {
+        ++lineNumber;
+        if (line.find_first_not_of(" \t") == std::string_view::npos) {
+            continue;
+        }
+
+        Slope slope;
+        auto pos = line.data() + line.find_first_not_of(" \t");
+        auto end = line.data() + line.size();
+        auto result = std::from_chars(pos, end, slope.dx);
+        auto ok = result.ec == std::errc() && result.ptr != end && (*result.ptr == ',' || *result.ptr == ' ');
+        if (ok) {
+            pos = result.ptr + 1;
+            while (pos != end && *pos == ' ') {
+                ++pos;
+            }
+            result = std::from_chars(pos, end, slope.dy);
+            ok = result.ec == std::errc() && std::all_of(result.ptr, end, [](char c) { return c == ' ' || c == '\t'; });
+        }
+
+        if (!ok) {
+            throw std::runtime_error("Bad slope on line " + std::to_string(lineNumber) + ": " + std::string(line));
+        }
+        slopes.push_back(slope);
+    }
+
+    return slopes;
+}
+
+void checkSlopes(const std::vector<Slope>& slopes)
+{
+    for (const auto& slope : slopes) {
+        if (slope.dy == 0) {
+            throw std::invalid_argument("Slopes must move down at least one row");
+        }
+    }
+}
+
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "Parallel.h"
+
+namespace aoc::y2020 {
+
+struct Slope
+{
+    size_t dx;
+    size_t dy;
+};
+
+// One slope per line as "dx,dy" or "dx dy", blank lines are skipped.
+// Throws std::runtime_error on anything else.
+std::vector<Slope> parseSlopes(std::string_view text);
+
+// Throws std::invalid_argument if any slope doesn't move down.
+void checkSlopes(const std::vector<Slope>& slopes);
+
+/**
+ * Trees hit by each slope on any grid with width(), height() and
+ * isTree(x, y), in the same order as the slopes.
+ *
+ * The map repeats to the right, so a slope visits (k * dx % width, k * dy)
+ * for every k >= 1 with k * dy inside the map. The starting square is never
+ * counted.
+ *
+ * The rows are walked once from top to bottom for any number of slopes, a
+ * block of rows at a time. Within a block each slope jumps straight from
+ * one row it lands on to the next, so a slope costs one step per row it
+ * lands on plus one per block, and the block stays in cache while every
+ * slope passes through it. With threads > 1 the slopes are split into
+ * groups and each thread sweeps the grid for its own group, counting in
+ * its own cursors and storing the totals once at the end.
+ **/
+template<typename Grid>
+std::vector<size_t> countTreesOn(const Grid& grid, const std::vector<Slope>& slopes, size_t threads = 1)
+{
+    checkSlopes(slopes);
+
+    std::vector<size_t> trees(slopes.size(), 0);
+    if (grid.width() == 0) {
+        return trees;
+    }
+
+    auto groups = std::clamp<size_t>(threads, 1, std::max<size_t>(slopes.size(), 1));
+    parallelFor(groups, [&](size_t group) {
+        struct Cursor
+        {
+            size_t dx;
+            size_t dy;
+            size_t x;
+            size_t nextRow;
+            size_t trees;
+        };
+
+        auto first = slopes.size() * group / groups;
+        auto last = slopes.size() * (group + 1) / groups;
+        std::vector<Cursor> cursors;
+        cursors.reserve(last - first);
+        for (auto idx = first; idx < last; ++idx) {
+            cursors.push_back({ slopes[idx].dx % grid.width(), slopes[idx].dy, 0, slopes[idx].dy, 0 });
+        }
+
+        constexpr size_t blockRows = 256;
+        for (size_t blockStart = 0; blockStart < grid.height(); blockStart += blockRows) {
+            auto blockEnd = std::min(blockStart + blockRows, grid.height());
+            for (auto& cursor : cursors) {
+                for (; cursor.nextRow < blockEnd; cursor.nextRow += cursor.dy) {
+                    cursor.x += cursor.dx;
+                    if (cursor.x >= grid.width()) {
+                        cursor.x -= grid.width();
+                    }
+                    cursor.trees += grid.isTree(cursor.x, cursor.nextRow);
+                }
+            }
+        }
+
+        for (size_t idx = 0; idx < cursors.size(); ++idx) {
+            trees[first + idx] = cursors[idx].trees;
+        }
+    });
+
+    return trees;
+}
+
+}
@@ -0,0 +1,109 @@
+#include "TrackedMap.h"
+
+#include <stdexcept>
+
+#include "Product.h"
+
+namespace aoc::y2020 {
+
+TrackedMap::TrackedMap(const GridView& grid)
+{
+    for (size_t y = 0; y < grid.height(); ++y) {
+        appendRow(std::string_view(grid.row(y), grid.width()));
+    }
+}
+
+size_t TrackedMap::addSlope(Slope slope)
+{
+    checkSlopes({ slope });
+
+    size_t trees = 0;
+    size_t x;
+    for (auto y = slope.dy; y < m_height; y += slope.dy) {
+        if (landsOn(slope, y, x)) {
+            trees += isTree(x, y);
+        }
+    }
+
+    m_slopes.push_back(slope);
+    m_trees.push_back(trees);
+    return m_slopes.size() - 1;
+}
+
+void TrackedMap::setTree(size_t x, size_t y)
+{
+    update(x, y, true);
+}
+
+void TrackedMap::clearTree(size_t x, size_t y)
+{
+    update(x, y, false);
+}
+
+void TrackedMap::appendRow(std::string_view row)
+{
+    if (row.empty()) {
+        throw std::runtime_error("Row " + std::to_string(m_height + 1) + " is empty");
+    }
+    if (m_height == 0) {
+        m_width = row.size();
+        m_stride = (m_width + 63) / 64;
+    } else if (row.size() != m_width) {
+        throw std::runtime_error(
+            "Row " + std::to_string(m_height + 1) + " is " + std::to_string(row.size())
+            + " wide, expected " + std::to_string(m_width));
+    }
+
+    m_bits.resize(m_bits.size() + m_stride, 0);
+    auto bits = m_bits.data() + m_height * m_stride;
+    for (size_t x = 0; x < row.size(); ++x) {
+        bits[x >> 6] |= uint64_t(row[x] == '#') << (x & 63);
+    }
+
+    auto y = m_height++;
+    size_t x;
+    for (size_t idx = 0; idx < m_slopes.size(); ++idx) {
+        if (landsOn(m_slopes[idx], y, x)) {
+            m_trees[idx] += isTree(x, y);
+        }
+    }
+}
+
+std::string TrackedMap::product(size_t first) const
+{
+    return exactProduct(std::vector<uint64_t>(m_trees.begin() + first, m_trees.end()));
+}
+
+bool TrackedMap::landsOn(const Slope& slope, size_t y, size_t& x) const
+{
+    // No columns to land in, and nothing to take the modulo by.
+    if (m_width == 0 || y == 0 || y % slope.dy != 0) {
+        return false;
+    }
+
+    // k * dx % width without overflowing for tall maps.
+    auto steps = y / slope.dy;
+    x = (steps % m_width) * (slope.dx % m_width) % m_width;
+    return true;
+}
+
+void TrackedMap::update(size_t x, size_t y, bool tree)
+{
+    if (x >= m_width || y >= m_height) {
+        throw std::out_of_range("(" + std::to_string(x) + ", " + std::to_string(y) + ") is outside the map");
+    }
+    if (isTree(x, y) == tree) {
+        return;
+    }
+
+    m_bits[y * m_stride + (x >> 6)] ^= uint64_t(1) << (x & 63);
+
+    size_t landed;
+    for (size_t idx = 0; idx < m_slopes.size(); ++idx) {
+        if (landsOn(m_slopes[idx], y, landed) && landed == x) {
+            m_trees[idx] = tree ? m_trees[idx] + 1 : m_trees[idx] - 1;
+        }
+    }
+}
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "GridView.h"
+#include "Slopes.h"
+
+namespace aoc::y2020 {
+
+/**
+ * An editable tree map that keeps the tree count of every registered slope
+ * up to date.
+ *
+ * A slope passes through (x, y) only if y = k * dy for some k >= 1 and
+ * x = k * dx % width, which is a couple of integer operations to check. So
+ * setTree() and clearTree() update the counts in O(#slopes) instead of
+ * walking the map again, and so does appendRow(), which grows the map at
+ * the bottom for inputs that arrive a row at a time.
+ *
+ * Rows are stored packed one bit per cell, as in TreeMap. Widths are
+ * expected to stay below 2^32.
+ **/
+class TrackedMap
+{
+public:
+    // An empty map, the first appended row sets the width.
+    TrackedMap() = default;
+    explicit TrackedMap(const GridView& grid);
+
+    size_t width() const { return m_width; }
+    size_t height() const { return m_height; }
+
+    bool isTree(size_t x, size_t y) const { return (m_bits[y * m_stride + (x >> 6)] >> (x & 63)) & 1; }
+
+    // Registers a slope and counts its trees so far, returns its index.
+    // Throws std::invalid_argument if dy is 0.
+    size_t addSlope(Slope slope);
+
+    // Throws std::out_of_range outside the map.
+    void setTree(size_t x, size_t y);
+    void clearTree(size_t x, size_t y);
+
+    // Adds a row of '.' and '#' at the bottom. Throws std::runtime_error if
+    // it's empty or isn't as wide as the rows before it.
+    void appendRow(std::string_view row);
+
+    size_t trees(size_t slope) const { return m_trees[slope]; }
+    const std::vector<size_t>& trees() const { return m_trees; }
+
+    // Exact product of the counts of every slope from index 'first' on.
+    std::string product(size_t first = 0) const;
+
+private:
+    // Whether the slope lands on row y, and if so in which column.
+    bool landsOn(const Slope& slope, size_t y, size_t& x) const;
+    void update(size_t x, size_t y, bool tree);
+
+    size_t m_width = 0;
+    size_t m_height = 0;
+
+    // Words per row.
+    size_t m_stride = 0;
+    std::vector<uint64_t> m_bits;
+
+    std::vector<Slope> m_slopes;
+    std::vector<size_t> m_trees;
+};
+
+}
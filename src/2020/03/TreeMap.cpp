@@ -0,0 +1,20 @@
+#include "TreeMap.h"
+
+namespace aoc::y2020 {
+
+TreeMap::TreeMap(const GridView& grid)
+    : m_width(grid.width())
+    , m_height(grid.height())
+    , m_stride((grid.width() + 63) / 64)
+    , m_bits(m_height * m_stride, 0)
+{
+    for (size_t y = 0; y < m_height; ++y) {
+        auto cells = grid.row(y);
+        auto row = m_bits.data() + y * m_stride;
+        for (size_t x = 0; x < m_width; ++x) {
+            row[x >> 6] |= uint64_t(cells[x] == '#') << (x & 63);
+        }
+    }
+}
+
+}
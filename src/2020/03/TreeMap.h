@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "GridView.h"
+#include "Slopes.h"
+
+namespace aoc::y2020 {
+
+/**
+ * The tree grid packed one bit per cell, with each row padded to whole
+ * 64-bit words.
+ *
+ * An eighth of the size of the text grid, so tall maps stay in cache across
+ * many slopes, at the cost of one pass over the input to build it.
+ *
+ * The map is never modified after construction, so any number of threads
+ * can count on it at once.
+ **/
+class TreeMap
+{
+public:
+    explicit TreeMap(const GridView& grid);
+
+    size_t width() const { return m_width; }
+    size_t height() const { return m_height; }
+
+    bool isTree(size_t x, size_t y) const { return (m_bits[y * m_stride + (x >> 6)] >> (x & 63)) & 1; }
+
+    // See countTreesOn().
+    std::vector<size_t> countTrees(const std::vector<Slope>& slopes, size_t threads = 1) const
+    {
+        return countTreesOn(*this, slopes, threads);
+    }
+    size_t countTrees(Slope slope) const { return countTrees(std::vector<Slope>{ slope }).front(); }
+
+private:
+    size_t m_width = 0;
+    size_t m_height = 0;
+
+    // Words per row.
+    size_t m_stride = 0;
+    std::vector<uint64_t> m_bits;
+};
+
+}
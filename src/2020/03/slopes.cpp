@@ -0,0 +1,102 @@
+/**
+ * Counts trees for a large set of slopes over one Day 3 map.
+ *
+ *   2020_03_slopes <map> [--slopes <file>] [--grid <dx>x<dy>] [--threads <n>] [--packed] [--print]
+ *
+ * Slopes come from a file (see parseSlopes) and/or a grid of every slope
+ * from 1,1 to dx,dy. The default is the five Part 2 slopes. They're split
+ * across --threads threads (default: one per core) and the throughput is
+ * reported. The map is read in place unless --packed copies it into a
+ * bitmap first. --print lists each slope's count and the full product.
+ **/
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GridView.h"
+#include "Input.h"
+#include "Parallel.h"
+#include "Product.h"
+#include "TreeMap.h"
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: 2020_03_slopes <map> [--slopes <file>] [--grid <dx>x<dy>] [--threads <n>] [--packed] [--print]" << std::endl;
+        return 1;
+    }
+
+    try {
+        auto threads = aoc::hardwareThreads();
+        auto print = false;
+        auto packed = false;
+        std::vector<aoc::y2020::Slope> slopes;
+        for (auto idx = 2; idx < argc; ++idx) {
+            std::string arg = argv[idx];
+            if (arg == "--slopes" && idx + 1 < argc) {
+                auto parsed = aoc::y2020::parseSlopes(aoc::Input::open(argv[++idx]).data());
+                slopes.insert(slopes.end(), parsed.begin(), parsed.end());
+            } else if (arg == "--grid" && idx + 1 < argc) {
+                std::string grid = argv[++idx];
+                auto cross = grid.find('x');
+                auto maxDx = std::stoull(grid.substr(0, cross));
+                auto maxDy = std::stoull(grid.substr(cross + 1));
+                for (size_t dy = 1; dy <= maxDy; ++dy) {
+                    for (size_t dx = 1; dx <= maxDx; ++dx) {
+                        slopes.push_back({ dx, dy });
+                    }
+                }
+            } else if (arg == "--threads" && idx + 1 < argc) {
+                threads = std::stoull(argv[++idx]);
+            } else if (arg == "--packed") {
+                packed = true;
+            } else if (arg == "--print") {
+                print = true;
+            }
+        }
+
+        if (slopes.empty()) {
+            slopes = { { 1, 1 }, { 3, 1 }, { 5, 1 }, { 7, 1 }, { 1, 2 } };
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        auto input = aoc::Input::open(argv[1]);
+        aoc::y2020::GridView grid(input.data());
+        auto map = packed ? std::make_unique<aoc::y2020::TreeMap>(grid) : nullptr;
+
+        auto t1 = std::chrono::steady_clock::now();
+
+        auto trees = map ? map->countTrees(slopes, threads) : grid.countTrees(slopes, threads);
+
+        auto t2 = std::chrono::steady_clock::now();
+
+        auto product = aoc::exactProduct(std::vector<uint64_t>(trees.begin(), trees.end()));
+
+        if (print) {
+            for (size_t idx = 0; idx < slopes.size(); ++idx) {
+                std::cout << slopes[idx].dx << "," << slopes[idx].dy << ": " << trees[idx] << std::endl;
+            }
+            std::cout << "Product: " << product << std::endl;
+        } else {
+            std::cout << "Product: " << product.size() << " digits" << std::endl;
+        }
+
+        auto build = std::chrono::duration_cast<std::chrono::microseconds>(t1 - start).count();
+        auto sweep = std::chrono::duration<double>(t2 - t1).count();
+        std::cout
+            << "Map: " << grid.width() << "x" << grid.height() << (packed ? " packed" : "") << " (" << build << "us)" << std::endl
+            << "Slopes: " << slopes.size() << " on " << std::min(threads, slopes.size()) << " threads"
+            << " (" << static_cast<int64_t>(sweep * 1e6) << "us)" << std::endl
+            << "Throughput: " << static_cast<int64_t>(slopes.size() / std::max(sweep, 1e-9)) << " slopes/s" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
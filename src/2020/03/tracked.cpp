@@ -0,0 +1,104 @@
+/**
+ * Day 3 over a stream of rows and edits, with the answers kept current.
+ *
+ *   2020_03_tracked [file] [--slopes <file>] [--quiet]
+ *
+ * Reads stdin unless given a file. Lines of '.' and '#' are added to the
+ * bottom of the map, "+x,y" plants a tree and "-x,y" cuts one down, blank
+ * lines are skipped. Both answers are printed after every edit (unless
+ * --quiet) and at the end.
+ * --slopes replaces the Part 2 slopes, see parseSlopes().
+ *
+ * The times printed are wall clock latencies since the first row was read,
+ * a single pass over the stream. Per-day phase timings come from the runner's
+ * Benchmark, not from this tool.
+ **/
+#include <chrono>
+#include <charconv>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Input.h"
+#include "LineStream.h"
+#include "TrackedMap.h"
+
+int main(int argc, char** argv)
+{
+    std::string path = "-";
+    std::string slopeFile;
+    auto quiet = false;
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg = argv[idx];
+        if (arg == "--slopes" && idx + 1 < argc) {
+            slopeFile = argv[++idx];
+        } else if (arg == "--quiet") {
+            quiet = true;
+        } else {
+            path = arg;
+        }
+    }
+
+    try {
+        std::vector<aoc::y2020::Slope> slopes = { { 1, 1 }, { 3, 1 }, { 5, 1 }, { 7, 1 }, { 1, 2 } };
+        if (!slopeFile.empty()) {
+            slopes = aoc::y2020::parseSlopes(aoc::Input::open(slopeFile).data());
+        }
+
+        // Part 1's slope goes first so the rest are exactly the Part 2 slopes.
+        aoc::y2020::TrackedMap map;
+        auto part1 = map.addSlope({ 3, 1 });
+        for (const auto& slope : slopes) {
+            map.addSlope(slope);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        size_t edits = 0;
+        auto report = [&] {
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout
+                << "Part1: " << map.trees(part1) << ", Part2: " << map.product(part1 + 1)
+                << " (" << map.width() << "x" << map.height() << ", " << edits << " edits, " << elapsed << "us)" << std::endl;
+        };
+
+        aoc::LineStream stream(path);
+        std::string_view line;
+        while (stream.next(line)) {
+            if (line.empty()) {
+                continue;
+            }
+            if (line[0] != '+' && line[0] != '-') {
+                map.appendRow(line);
+                continue;
+            }
+
+            size_t x = 0;
+            size_t y = 0;
+            auto end = line.data() + line.size();
+            auto result = std::from_chars(line.data() + 1, end, x);
+            if (result.ec != std::errc() || result.ptr == end || *result.ptr != ','
+                || std::from_chars(result.ptr + 1, end, y).ec != std::errc()) {
+                throw std::runtime_error("Bad edit: " + std::string(line));
+            }
+
+            if (line[0] == '+') {
+                map.setTree(x, y);
+            } else {
+                map.clearTree(x, y);
+            }
+
+            ++edits;
+            if (!quiet) {
+                report();
+            }
+        }
+
+        report();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
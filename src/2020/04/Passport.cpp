@@ -0,0 +1,160 @@
+#include "Passport.h"
+
+#include <charconv>
+
+#include "PassportRules.h"
+
+namespace aoc::y2020 {
+
+namespace {
+
+bool isDigits(std::string_view input)
+{
+    for (auto c : input) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+    }
+
+    return !input.empty();
+}
+
+template<int MIN, int MAX>
+bool validateRange(std::string_view input)
+{
+    auto value = 0;
+    auto result = std::from_chars(input.data(), input.data() + input.size(), value);
+    return isDigits(input) && result.ec == std::errc() && value >= MIN && value <= MAX;
+}
+
+template<size_t LENGTH>
+bool validateIsNumber(std::string_view input)
+{
+    return input.length() == LENGTH && isDigits(input);
+}
+
+bool validateColorCode(std::string_view input)
+{
+    if (input.length() != 7 || input[0] != '#') {
+        return false;
+    }
+
+    for (auto c : input.substr(1)) {
+        if ((c < '0' || c > '9') && (c < 'a' || c > 'f')) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// exactly one of: amb blu brn gry grn hzl oth
+bool validateEyeColor(std::string_view input)
+{
+    if (input.length() != 3) {
+        return false;
+    }
+
+    switch (Passport::packKey(input[0], input[1], input[2])) {
+    case Passport::packKey('a', 'm', 'b'):
+    case Passport::packKey('b', 'l', 'u'):
+    case Passport::packKey('b', 'r', 'n'):
+    case Passport::packKey('g', 'r', 'y'):
+    case Passport::packKey('g', 'r', 'n'):
+    case Passport::packKey('h', 'z', 'l'):
+    case Passport::packKey('o', 't', 'h'):
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool validateHeight(std::string_view input)
+{
+    //hgt (Height) - a number followed by either cm or in
+    // If cm, the number must be at least 150 and at most 193.
+    // If in, the number must be at least 59 and at most 76.
+    if (input.length() < 3) {
+        // Not enough room for a number followed by the unit
+        return false;
+    }
+
+    auto number = input.substr(0, input.length() - 2);
+    auto unit = input.substr(input.length() - 2);
+    if (unit == "cm") {
+        return validateRange<150, 193>(number);
+    }
+    if (unit == "in") {
+        return validateRange<59, 76>(number);
+    }
+
+    return false;
+}
+
+}
+
+bool Passport::validateField(int field, std::string_view value)
+{
+    switch (field) {
+    case BIRTH_YEAR: return validateRange<1920, 2002>(value);
+    case ISSUE_YEAR: return validateRange<2010, 2020>(value);
+    case EXPIRY_YEAR: return validateRange<2020, 2030>(value);
+    case PASSPORT_ID: return validateIsNumber<9>(value);
+    case COUNTRY_ID: return true;
+    case HEIGHT: return validateHeight(value);
+    case HAIR_COLOR: return validateColorCode(value);
+    case EYE_COLOR: return validateEyeColor(value);
+    default: return false;
+    }
+}
+
+Passport Passport::fromRecord(std::string_view record, const PassportRules* rules)
+{
+    Passport passport;
+    size_t pos = 0;
+    while (pos < record.size()) {
+        auto end = record.find_first_of(" \r\n", pos);
+        if (end == std::string_view::npos) {
+            end = record.size();
+        }
+
+        auto field = record.substr(pos, end - pos);
+        auto colon = field.find(':');
+        if (colon != std::string_view::npos) {
+            passport.addField(field.substr(0, colon), field.substr(colon + 1), rules);
+        }
+
+        pos = end + 1;
+    }
+
+    return passport;
+}
+
+void Passport::addField(std::string_view key, std::string_view value, const PassportRules* rules)
+{
+    auto field = fieldFromKey(key);
+    if (field < 0) {
+        return;
+    }
+
+    // Mark field exists, and valid if it passes validity check
+    m_isFieldSet |= uint8_t(1 << field);
+    if (rules != nullptr ? rules->matches(field, value) : validateField(field, value)) {
+        m_isFieldValid |= uint8_t(1 << field);
+    }
+}
+
+PassportCounts countPassports(
+    std::span<const std::string_view> records, uint8_t required, const PassportRules* rules)
+{
+    PassportCounts counts;
+    for (auto record : records) {
+        auto passport = Passport::fromRecord(record, rules);
+        counts.present += passport.hasFields(required);
+        counts.valid += passport.hasValidFields(required);
+    }
+
+    return counts;
+}
+
+}
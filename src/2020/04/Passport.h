@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace aoc::y2020 {
+
+class PassportRules;
+
+/**
+ * Which fields a passport has, and which of those hold valid values.
+ *
+ * Keys are dispatched on their three bytes packed into an integer, so
+ * finding a field is a switch over constants rather than a string hash,
+ * and each validator is a direct call on a view of the value. Nothing is
+ * copied or allocated, and a Passport is two bytes that live wherever the
+ * caller puts them.
+ *
+ * Values are checked by the hand written validators, or by compiled
+ * PassportRules when given some.
+ **/
+class Passport
+{
+public:
+    enum Field {
+        BIRTH_YEAR = 0,
+        ISSUE_YEAR,
+        EXPIRY_YEAR,
+        PASSPORT_ID,
+        COUNTRY_ID,
+        HEIGHT,
+        HAIR_COLOR,
+        EYE_COLOR,
+
+        NUM_FIELDS
+    };
+
+    static constexpr uint32_t packKey(char a, char b, char c)
+    {
+        return uint32_t(uint8_t(a)) | uint32_t(uint8_t(b)) << 8 | uint32_t(uint8_t(c)) << 16;
+    }
+
+    // Field for a three letter key, or -1 if it isn't one.
+    static constexpr int fieldFromKey(std::string_view key)
+    {
+        if (key.size() != 3) {
+            return -1;
+        }
+
+        switch (packKey(key[0], key[1], key[2])) {
+        case packKey('b', 'y', 'r'): return BIRTH_YEAR;
+        case packKey('i', 'y', 'r'): return ISSUE_YEAR;
+        case packKey('e', 'y', 'r'): return EXPIRY_YEAR;
+        case packKey('p', 'i', 'd'): return PASSPORT_ID;
+        case packKey('c', 'i', 'd'): return COUNTRY_ID;
+        case packKey('h', 'g', 't'): return HEIGHT;
+        case packKey('h', 'c', 'l'): return HAIR_COLOR;
+        case packKey('e', 'c', 'l'): return EYE_COLOR;
+        default: return -1;
+        }
+    }
+
+    static bool validateField(int field, std::string_view value);
+
+    // Reads "key:value" fields separated by spaces or line breaks.
+    static Passport fromRecord(std::string_view record, const PassportRules* rules = nullptr);
+
+    // Unknown keys are ignored.
+    void addField(std::string_view key, std::string_view value, const PassportRules* rules = nullptr);
+
+    // 'required' has bit n set for each Field n that must be there.
+    bool hasFields(uint8_t required) const { return (m_isFieldSet & required) == required; }
+    bool hasValidFields(uint8_t required) const { return (m_isFieldValid & required) == required; }
+
+private:
+    // Field exists if bit is set
+    uint8_t m_isFieldSet = 0;
+
+    // Field is valid if bit is set
+    uint8_t m_isFieldValid = 0;
+};
+
+static_assert(sizeof(Passport) == 2);
+
+struct PassportCounts
+{
+    size_t present = 0;
+    size_t valid = 0;
+};
+
+// How many of the records have all the required fields, and how many have
+// them all valid. Each record is read into a Passport on the stack, so
+// nothing is allocated however many records there are.
+PassportCounts countPassports(
+    std::span<const std::string_view> records, uint8_t required, const PassportRules* rules = nullptr);
+
+static_assert(Passport::fieldFromKey("hgt") == Passport::HEIGHT);
+static_assert(Passport::fieldFromKey("xyz") == -1);
+
+}
@@ -0,0 +1,413 @@
+#include "PassportRules.h"
+
+#include <algorithm>
+#include <bitset>
+#include <charconv>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "Input.h"
+
+namespace aoc::y2020 {
+
+namespace {
+
+constexpr std::string_view builtinSpec = R"(// The puzzle's Part 2 rules.
+byr range 1920-2002
+iyr range 2010-2020
+eyr range 2020-2030
+hgt range 150-193 cm | range 59-76 in
+hcl pattern #[0-9a-f]{6}
+ecl one-of amb blu brn gry grn hzl oth
+pid pattern [0-9]{9}
+cid any
+)";
+
+using ByteSet = std::bitset<256>;
+
+ByteSet byteRange(char first, char last)
+{
+    ByteSet bytes;
+    for (int c = static_cast<uint8_t>(first); c <= static_cast<uint8_t>(last); ++c) {
+        bytes.set(c);
+    }
+
+    return bytes;
+}
+
+ByteSet singleByte(char c)
+{
+    return byteRange(c, c);
+}
+
+class Nfa
+{
+public:
+    struct State
+    {
+        std::vector<std::pair<ByteSet, int>> edges;
+        std::vector<int> epsilon;
+    };
+
+    int add()
+    {
+        m_states.emplace_back();
+        return static_cast<int>(m_states.size() - 1);
+    }
+
+    void edge(int from, const ByteSet& bytes, int to) { m_states[from].edges.emplace_back(bytes, to); }
+    void epsilon(int from, int to) { m_states[from].epsilon.push_back(to); }
+
+    const std::vector<State>& states() const { return m_states; }
+
+    // Sorted set of states reachable from 'states' without consuming a byte.
+    std::vector<int> closure(std::vector<int> states) const
+    {
+        std::vector<bool> seen(m_states.size(), false);
+        for (auto state : states) {
+            seen[state] = true;
+        }
+
+        for (size_t idx = 0; idx < states.size(); ++idx) {
+            for (auto next : m_states[states[idx]].epsilon) {
+                if (!seen[next]) {
+                    seen[next] = true;
+                    states.push_back(next);
+                }
+            }
+        }
+
+        std::sort(states.begin(), states.end());
+        return states;
+    }
+
+private:
+    std::vector<State> m_states;
+};
+
+void addLiteral(Nfa& nfa, int from, int to, std::string_view text)
+{
+    for (auto c : text) {
+        auto next = nfa.add();
+        nfa.edge(from, singleByte(c), next);
+        from = next;
+    }
+    nfa.epsilon(from, to);
+}
+
+// Digit strings of lo's length between lo and hi, which are the same length.
+void addDigits(Nfa& nfa, int from, int to, std::string_view lo, std::string_view hi)
+{
+    auto isAll = [](std::string_view text, char c) { return std::all_of(text.begin(), text.end(), [c](char x) { return x == c; }); };
+
+    // Every digit string of this length, a plain chain.
+    if (isAll(lo, '0') && isAll(hi, '9')) {
+        for (size_t idx = 0; idx < lo.size(); ++idx) {
+            auto next = nfa.add();
+            nfa.edge(from, byteRange('0', '9'), next);
+            from = next;
+        }
+        nfa.epsilon(from, to);
+        return;
+    }
+
+    if (lo[0] == hi[0]) {
+        auto next = nfa.add();
+        nfa.edge(from, singleByte(lo[0]), next);
+        addDigits(nfa, next, to, lo.substr(1), hi.substr(1));
+        return;
+    }
+
+    // Split on the first digit: lo's own, the ones strictly between, and hi's.
+    std::string zeros(lo.size() - 1, '0');
+    std::string nines(lo.size() - 1, '9');
+
+    auto low = nfa.add();
+    nfa.edge(from, singleByte(lo[0]), low);
+    addDigits(nfa, low, to, lo.substr(1), nines);
+
+    if (hi[0] - lo[0] > 1) {
+        auto middle = nfa.add();
+        nfa.edge(from, byteRange(lo[0] + 1, hi[0] - 1), middle);
+        addDigits(nfa, middle, to, zeros, nines);
+    }
+
+    auto high = nfa.add();
+    nfa.edge(from, singleByte(hi[0]), high);
+    addDigits(nfa, high, to, zeros, hi.substr(1));
+}
+
+void addRange(Nfa& nfa, int from, int to, uint64_t lo, uint64_t hi)
+{
+    // Leading zeros, then the number without them.
+    auto zeros = nfa.add();
+    nfa.epsilon(from, zeros);
+    nfa.edge(zeros, singleByte('0'), zeros);
+
+    auto loText = std::to_string(lo);
+    auto hiText = std::to_string(hi);
+    for (auto length = loText.size(); length <= hiText.size(); ++length) {
+        auto first = length == loText.size() ? loText : "1" + std::string(length - 1, '0');
+        auto last = length == hiText.size() ? hiText : std::string(length, '9');
+        addDigits(nfa, zeros, to, first, last);
+    }
+}
+
+void addPattern(Nfa& nfa, int from, int to, std::string_view pattern)
+{
+    size_t pos = 0;
+    auto fail = [&](const char* what) {
+        throw std::runtime_error(std::string(what) + " in pattern " + std::string(pattern));
+    };
+
+    while (pos < pattern.size()) {
+        // Each atom gets its own entry state, so a repeat can't loop back
+        // into whatever came before it.
+        auto atom = nfa.add();
+        nfa.epsilon(from, atom);
+        from = atom;
+
+        // One atom...
+        ByteSet bytes;
+        if (pattern[pos] == '[') {
+            auto close = pattern.find(']', pos + 1);
+            if (close == std::string_view::npos || close == pos + 1) {
+                fail("Bad class");
+            }
+            for (auto idx = pos + 1; idx < close; ++idx) {
+                if (idx + 2 < close && pattern[idx + 1] == '-') {
+                    bytes |= byteRange(pattern[idx], pattern[idx + 2]);
+                    idx += 2;
+                } else {
+                    bytes.set(static_cast<uint8_t>(pattern[idx]));
+                }
+            }
+            pos = close + 1;
+        } else if (pattern[pos] == '.') {
+            bytes.set();
+            ++pos;
+        } else {
+            bytes = singleByte(pattern[pos++]);
+        }
+
+        // ...and how many times it repeats.
+        size_t minCount = 1;
+        size_t maxCount = 1;
+        auto unbounded = false;
+        if (pos < pattern.size() && pattern[pos] == '{') {
+            auto close = pattern.find('}', pos);
+            if (close == std::string_view::npos) {
+                fail("Unclosed repeat");
+            }
+            auto end = pattern.data() + close;
+            auto result = std::from_chars(pattern.data() + pos + 1, end, minCount);
+            maxCount = minCount;
+            if (result.ec == std::errc() && result.ptr != end && *result.ptr == ',') {
+                result = std::from_chars(result.ptr + 1, end, maxCount);
+            }
+            if (result.ec != std::errc() || result.ptr != end || maxCount < minCount) {
+                fail("Bad repeat");
+            }
+            pos = close + 1;
+        } else if (pos < pattern.size() && (pattern[pos] == '?' || pattern[pos] == '*' || pattern[pos] == '+')) {
+            minCount = pattern[pos] == '+' ? 1 : 0;
+            unbounded = pattern[pos] != '?';
+            pos++;
+        }
+
+        for (size_t count = 0; count < minCount; ++count) {
+            auto next = nfa.add();
+            nfa.edge(from, bytes, next);
+            from = next;
+        }
+
+        auto next = nfa.add();
+        nfa.epsilon(from, next);
+        if (unbounded) {
+            nfa.edge(from, bytes, from);
+        } else {
+            for (auto count = minCount; count < maxCount; ++count) {
+                auto optional = nfa.add();
+                nfa.edge(from, bytes, optional);
+                nfa.epsilon(optional, next);
+                from = optional;
+            }
+        }
+        from = next;
+    }
+
+    nfa.epsilon(from, to);
+}
+
+std::vector<std::string_view> splitWords(std::string_view line)
+{
+    std::vector<std::string_view> words;
+    size_t pos = 0;
+    while ((pos = line.find_first_not_of(" \t", pos)) != std::string_view::npos) {
+        auto end = std::min(line.find_first_of(" \t", pos), line.size());
+        words.push_back(line.substr(pos, end - pos));
+        pos = end;
+    }
+
+    return words;
+}
+
+// Adds one alternative, words[first, last), between from and to.
+void addAlternative(Nfa& nfa, int from, int to, const std::vector<std::string_view>& words, size_t first, size_t last)
+{
+    if (first == last) {
+        throw std::runtime_error("Empty alternative");
+    }
+
+    auto kind = words[first];
+    auto args = last - first - 1;
+    if (kind == "any" && args == 0) {
+        auto loop = nfa.add();
+        nfa.epsilon(from, loop);
+        nfa.edge(loop, ByteSet().set(), loop);
+        nfa.epsilon(loop, to);
+    } else if (kind == "one-of" && args > 0) {
+        for (auto idx = first + 1; idx < last; ++idx) {
+            addLiteral(nfa, from, to, words[idx]);
+        }
+    } else if (kind == "pattern" && args == 1) {
+        addPattern(nfa, from, to, words[first + 1]);
+    } else if (kind == "range" && (args == 1 || args == 2)) {
+        auto range = words[first + 1];
+        auto dash = range.find('-');
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+        auto loResult = std::from_chars(range.data(), range.data() + std::min(dash, range.size()), lo);
+        auto hiResult = std::from_chars(range.data() + std::min(dash + 1, range.size()), range.data() + range.size(), hi);
+        if (dash == std::string_view::npos || loResult.ec != std::errc() || hiResult.ec != std::errc()
+            || loResult.ptr != range.data() + dash || hiResult.ptr != range.data() + range.size() || lo > hi) {
+            throw std::runtime_error("Bad range " + std::string(range));
+        }
+
+        auto suffix = nfa.add();
+        addRange(nfa, from, suffix, lo, hi);
+        addLiteral(nfa, suffix, to, args == 2 ? words[first + 2] : std::string_view());
+    } else {
+        throw std::runtime_error("Unknown rule " + std::string(kind));
+    }
+}
+
+}
+
+PassportRules PassportRules::compile(std::string_view spec)
+{
+    // Every field's rule ends in the same accepting state, it has no way out.
+    Nfa nfa;
+    auto accept = nfa.add();
+    int starts[Passport::NUM_FIELDS];
+    std::fill(std::begin(starts), std::end(starts), -1);
+
+    size_t lineNumber = 0;
+    for (auto line : LineRange(spec, false)) {
+        ++lineNumber;
+        auto words = splitWords(line);
+        if (words.empty() || words[0].substr(0, 2) == "//") {
+            continue;
+        }
+
+        try {
+            auto field = Passport::fieldFromKey(words[0]);
+            if (field < 0) {
+                throw std::runtime_error("Unknown field " + std::string(words[0]));
+            }
+            if (starts[field] < 0) {
+                starts[field] = nfa.add();
+            }
+
+            // A second rule for the same field adds more alternatives.
+            size_t first = 1;
+            for (size_t idx = 1; idx <= words.size(); ++idx) {
+                if (idx == words.size() || words[idx] == "|") {
+                    addAlternative(nfa, starts[field], accept, words, first, idx);
+                    first = idx + 1;
+                }
+            }
+        } catch (const std::runtime_error& e) {
+            throw std::runtime_error("Rules line " + std::to_string(lineNumber) + ": " + e.what());
+        }
+    }
+
+    PassportRules rules;
+
+    // Bytes that every edge treats the same way share a class, so the table
+    // only needs a column per class.
+    std::map<std::vector<bool>, uint8_t> classes;
+    for (size_t c = 0; c < 256; ++c) {
+        std::vector<bool> signature;
+        for (const auto& state : nfa.states()) {
+            for (const auto& [bytes, next] : state.edges) {
+                signature.push_back(bytes.test(c));
+            }
+        }
+
+        auto found = classes.emplace(std::move(signature), static_cast<uint8_t>(classes.size()));
+        rules.m_byteClass[c] = found.first->second;
+    }
+    rules.m_classes = classes.size();
+
+    std::vector<uint8_t> representative(rules.m_classes);
+    for (size_t c = 256; c-- > 0;) {
+        representative[rules.m_byteClass[c]] = static_cast<uint8_t>(c);
+    }
+
+    // Subset construction, with the empty set as the dead state 0.
+    std::map<std::vector<int>, uint16_t> dfaStates;
+    std::vector<std::vector<int>> pending;
+    auto stateFor = [&](std::vector<int> set) {
+        auto found = dfaStates.find(set);
+        if (found != dfaStates.end()) {
+            return found->second;
+        }
+        if (dfaStates.size() > 0xFFFF) {
+            throw std::runtime_error("Rules need too many states");
+        }
+
+        auto id = static_cast<uint16_t>(dfaStates.size());
+        rules.m_accept.push_back(std::binary_search(set.begin(), set.end(), accept));
+        rules.m_next.resize(rules.m_next.size() + rules.m_classes, 0);
+        dfaStates.emplace(set, id);
+        pending.push_back(std::move(set));
+        return id;
+    };
+
+    stateFor({});
+    for (int field = 0; field < Passport::NUM_FIELDS; ++field) {
+        if (starts[field] >= 0) {
+            rules.m_start[field] = stateFor(nfa.closure({ starts[field] }));
+        }
+    }
+
+    for (size_t idx = 0; idx < pending.size(); ++idx) {
+        auto set = pending[idx];
+        for (size_t cls = 0; cls < rules.m_classes; ++cls) {
+            std::vector<int> moved;
+            for (auto state : set) {
+                for (const auto& [bytes, next] : nfa.states()[state].edges) {
+                    if (bytes.test(representative[cls])) {
+                        moved.push_back(next);
+                    }
+                }
+            }
+
+            std::sort(moved.begin(), moved.end());
+            moved.erase(std::unique(moved.begin(), moved.end()), moved.end());
+            auto target = moved.empty() ? uint16_t(0) : stateFor(nfa.closure(std::move(moved)));
+            rules.m_next[idx * rules.m_classes + cls] = target;
+        }
+    }
+
+    return rules;
+}
+
+std::string_view PassportRules::defaultSpec()
+{
+    return builtinSpec;
+}
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "Passport.h"
+
+namespace aoc::y2020 {
+
+/**
+ * Field validation rules read from a text spec and compiled into one
+ * table-driven DFA.
+ *
+ * One rule per line, the field's key followed by one or more alternatives
+ * separated by '|':
+ *
+ *   range <lo>-<hi> [<suffix>]  a decimal number in [lo, hi], leading zeros
+ *                               allowed, followed by the literal suffix
+ *   one-of <word>...            exactly one of the words
+ *   pattern <pattern>           literal bytes, [classes] such as [0-9a-f]
+ *                               and '.', each optionally repeated with {n},
+ *                               {n,m}, '?', '*' or '+'
+ *   any                         anything, including nothing
+ *
+ * Lines starting with "//" are comments. Fields without a rule are never
+ * valid. defaultSpec() holds the puzzle's rules.
+ *
+ * Each rule becomes an NFA, and subset construction turns all of them into
+ * a single DFA over byte classes. Checking a value is then one table load
+ * per byte with no branches on the content, however many alternatives the
+ * rule has.
+ **/
+class PassportRules
+{
+public:
+    // Throws std::runtime_error on a malformed spec.
+    static PassportRules compile(std::string_view spec);
+
+    static std::string_view defaultSpec();
+
+    bool matches(int field, std::string_view value) const
+    {
+        auto state = m_start[field];
+        for (auto c : value) {
+            state = m_next[state * m_classes + m_byteClass[static_cast<uint8_t>(c)]];
+        }
+
+        return m_accept[state];
+    }
+
+    size_t states() const { return m_accept.size(); }
+    size_t byteClasses() const { return m_classes; }
+
+private:
+    PassportRules() = default;
+
+    // State 0 is the dead state, and the start state of fields without a rule.
+    uint16_t m_start[Passport::NUM_FIELDS] = {};
+
+    uint8_t m_byteClass[256] = {};
+    size_t m_classes = 0;
+
+    // m_next[state * m_classes + class]
+    std::vector<uint16_t> m_next;
+    std::vector<uint8_t> m_accept;
+};
+
+}
@@ -0,0 +1,74 @@
+#include "PassportScanner.h"
+
+namespace aoc::y2020 {
+
+void PassportScanner::feed(std::string_view chunk)
+{
+    for (auto c : chunk) {
+        switch (c) {
+        case '\n':
+            endField();
+            if (++m_newlines == 2) {
+                endRecord();
+            }
+            break;
+        case '\r':
+            endField();
+            break;
+        case ' ':
+            endField();
+            m_newlines = 0;
+            break;
+        default:
+            m_inRecord = true;
+            m_newlines = 0;
+            if (m_fieldLength < maxFieldLength) {
+                m_field[m_fieldLength++] = c;
+            } else {
+                m_truncated = true;
+            }
+            break;
+        }
+    }
+}
+
+void PassportScanner::finish()
+{
+    endField();
+    endRecord();
+    m_newlines = 0;
+}
+
+void PassportScanner::endField()
+{
+    if (m_fieldLength == 0) {
+        return;
+    }
+
+    std::string_view field(m_field, m_fieldLength);
+    auto colon = field.find(':');
+    if (colon != std::string_view::npos) {
+        // A cut off value can't be checked, so make sure it fails.
+        auto value = field.substr(colon + 1);
+        m_passport.addField(field.substr(0, colon), m_truncated ? std::string_view("!") : value, m_rules);
+    }
+
+    m_fieldLength = 0;
+    m_truncated = false;
+}
+
+void PassportScanner::endRecord()
+{
+    if (!m_inRecord) {
+        return;
+    }
+
+    ++m_records;
+    m_present += m_passport.hasFields(m_required);
+    m_valid += m_passport.hasValidFields(m_required);
+
+    m_passport = Passport();
+    m_inRecord = false;
+}
+
+}
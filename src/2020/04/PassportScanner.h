@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Passport.h"
+
+namespace aoc::y2020 {
+
+/**
+ * Counts complete and valid passports in a single pass over a batch file,
+ * fed in chunks of any size.
+ *
+ * Fields are split on spaces and line breaks and a blank line ends the
+ * record, the same as Input::records() and Passport::fromRecord(). The only
+ * state carried between chunks is the passport being read and the field
+ * that straddles the chunk boundary, held in a fixed buffer. Memory use
+ * doesn't depend on the size of the batch.
+ *
+ * No valid value comes close to the buffer size. A longer field still
+ * counts as present, but never as valid.
+ **/
+class PassportScanner
+{
+public:
+    // Checks values with the rules if given any, see Passport.
+    explicit PassportScanner(uint8_t required, const PassportRules* rules = nullptr)
+        : m_required(required)
+        , m_rules(rules)
+    {}
+
+    void feed(std::string_view chunk);
+
+    // Ends the last record, for batches that don't finish with a blank line.
+    void finish();
+
+    size_t records() const { return m_records; }
+    size_t present() const { return m_present; }
+    size_t valid() const { return m_valid; }
+
+private:
+    static constexpr size_t maxFieldLength = 64;
+
+    void endField();
+    void endRecord();
+
+    uint8_t m_required;
+    const PassportRules* m_rules;
+
+    Passport m_passport;
+    bool m_inRecord = false;
+
+    // Line breaks since the last byte that wasn't one, '\r' aside.
+    int m_newlines = 0;
+
+    char m_field[maxFieldLength];
+    size_t m_fieldLength = 0;
+    bool m_truncated = false;
+
+    size_t m_records = 0;
+    size_t m_present = 0;
+    size_t m_valid = 0;
+};
+
+}
@@ -0,0 +1,55 @@
+/**
+ * Day 4 over a batch file of any size, in constant memory.
+ *
+ *   2020_04_stream [file]
+ *
+ * Reads stdin unless given a file, a fixed size block at a time, and feeds
+ * the blocks through PassportScanner as read, so records and fields may
+ * span blocks. Prints both answers, the record count and the throughput.
+ *
+ * The throughput is one pass over the whole stream, reading included, so it
+ * is not comparable with the runner's per-phase Benchmark timings.
+ **/
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "LineStream.h"
+#include "PassportScanner.h"
+
+int main(int argc, char** argv)
+{
+    std::string path = argc > 1 ? argv[1] : "-";
+
+    try {
+        auto start = std::chrono::steady_clock::now();
+
+        // All fields except CID are required.
+        aoc::y2020::PassportScanner scanner(0xFF - (1 << aoc::y2020::Passport::COUNTRY_ID));
+        // Raw blocks rather than lines, so the buffer never grows past one
+        // block however long a line gets.
+        aoc::LineStream stream(path, 1 << 16);
+        size_t bytes = 0;
+        std::string_view block;
+        while (stream.nextBlock(block)) {
+            scanner.feed(block);
+            bytes += block.size();
+        }
+        scanner.finish();
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout
+            << "Part1: " << scanner.present() << std::endl
+            << "Part2: " << scanner.valid() << std::endl
+            << "Records: " << scanner.records() << " in " << bytes << " bytes, " << stream.capacity() << " buffered"
+            << " (" << static_cast<int64_t>(elapsed * 1e6) << "us, "
+            << static_cast<int64_t>(bytes / std::max(elapsed, 1e-9) / 1e6) << " MB/s)" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
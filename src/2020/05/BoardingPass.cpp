@@ -0,0 +1,174 @@
+#include "BoardingPass.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace aoc::y2020 {
+
+namespace {
+
+// Bytes from the start of a pass to the start of the next, or 0 if the pass
+// isn't 10 letters and a line ending. Reads up to pass[11].
+size_t passLength(const char* pass)
+{
+    // Letters all have bit 6 set and line endings don't, so a shorter line
+    // followed by a blank one can't pass for a pass.
+    uint64_t word;
+    std::memcpy(&word, pass, sizeof(word));
+    if ((word & 0x4040404040404040) != 0x4040404040404040 || !(pass[8] & 0x40) || !(pass[9] & 0x40)) {
+        return 0;
+    }
+
+    if (pass[10] == '\n') {
+        return 11;
+    }
+
+    return pass[10] == '\r' && pass[11] == '\n' ? 12 : 0;
+}
+
+// Decodes the line at pos and returns the start of the next one.
+const char* decodeLine(const char* pos, const char* end, std::vector<uint16_t>& ids)
+{
+    auto newline = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+    auto next = newline ? newline + 1 : end;
+    auto lineEnd = newline ? newline : end;
+    if (lineEnd != pos && lineEnd[-1] == '\r') {
+        --lineEnd;
+    }
+
+    if (lineEnd - pos == 10) {
+        ids.push_back(static_cast<uint16_t>(decodeSeat(pos)));
+    } else if (lineEnd != pos) {
+        throw std::runtime_error("Bad boarding pass: " + std::string(pos, lineEnd));
+    }
+
+    return next;
+}
+
+#if AOC_X86_64
+
+// Puts letter 9 - k of the pass in byte k of each 128-bit lane, so the
+// movemask comes out with the first letter in bit 9.
+AOC_TARGET("avx2")
+__m256i decodeOrderAvx2()
+{
+    return _mm256_setr_epi8(
+        9, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1, -1, -1, -1, -1, -1,
+        9, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1, -1, -1, -1, -1, -1);
+}
+
+// Two passes per register, one per 128-bit lane, and two registers per
+// iteration. Returns where it stopped, which is either close to the end
+// or a line the scalar path has to look at.
+AOC_TARGET("avx2")
+const char* decodeAvx2(const char* pos, const char* end, std::vector<uint16_t>& ids)
+{
+    auto order = decodeOrderAvx2();
+
+    // Four passes of at most 12 bytes, plus the 16 byte load of the last.
+    while (end - pos >= 52) {
+        const char* passes[4];
+        auto next = pos;
+        auto uniform = true;
+        for (auto& pass : passes) {
+            pass = next;
+            auto length = passLength(next);
+            uniform &= length != 0;
+            next += length != 0 ? length : 11;
+        }
+        if (!uniform) {
+            break;
+        }
+
+        uint32_t masks[2];
+        for (size_t half = 0; half < 2; ++half) {
+            auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(passes[2 * half]));
+            auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(passes[2 * half + 1]));
+            auto letters = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), order);
+
+            // Bit 2 of every byte up to bit 7, where movemask picks it up.
+            masks[half] = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_slli_epi16(letters, 5)));
+        }
+
+        ids.push_back(static_cast<uint16_t>(masks[0] & 0x3FF));
+        ids.push_back(static_cast<uint16_t>((masks[0] >> 16) & 0x3FF));
+        ids.push_back(static_cast<uint16_t>(masks[1] & 0x3FF));
+        ids.push_back(static_cast<uint16_t>((masks[1] >> 16) & 0x3FF));
+        pos = next;
+    }
+
+    return pos;
+}
+
+// Four passes per register, one per 128-bit lane.
+AOC_TARGET("avx512f,avx512bw")
+const char* decodeAvx512(const char* pos, const char* end, std::vector<uint16_t>& ids)
+{
+    auto order = _mm512_broadcast_i32x4(_mm_setr_epi8(9, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1, -1, -1, -1, -1, -1));
+
+    while (end - pos >= 52) {
+        const char* passes[4];
+        auto next = pos;
+        auto uniform = true;
+        for (auto& pass : passes) {
+            pass = next;
+            auto length = passLength(next);
+            uniform &= length != 0;
+            next += length != 0 ? length : 11;
+        }
+        if (!uniform) {
+            break;
+        }
+
+        auto letters = _mm512_castsi128_si512(_mm_loadu_si128(reinterpret_cast<const __m128i*>(passes[0])));
+        letters = _mm512_inserti32x4(letters, _mm_loadu_si128(reinterpret_cast<const __m128i*>(passes[1])), 1);
+        letters = _mm512_inserti32x4(letters, _mm_loadu_si128(reinterpret_cast<const __m128i*>(passes[2])), 2);
+        letters = _mm512_inserti32x4(letters, _mm_loadu_si128(reinterpret_cast<const __m128i*>(passes[3])), 3);
+        letters = _mm512_shuffle_epi8(letters, order);
+
+        auto mask = ~static_cast<uint64_t>(_mm512_movepi8_mask(_mm512_slli_epi16(letters, 5)));
+        for (size_t lane = 0; lane < 4; ++lane) {
+            ids.push_back(static_cast<uint16_t>((mask >> (16 * lane)) & 0x3FF));
+        }
+        pos = next;
+    }
+
+    return pos;
+}
+
+#endif
+
+}
+
+void decodeSeats(std::string_view buffer, SimdLevel level, std::vector<uint16_t>& ids)
+{
+    if (!resolveSimdLevel(level)) {
+        throw std::runtime_error("Boarding pass kernel is not supported on this CPU");
+    }
+
+    auto pos = buffer.data();
+    auto end = buffer.data() + buffer.size();
+    ids.reserve(ids.size() + buffer.size() / 11);
+    while (pos < end) {
+        switch (level) {
+#if AOC_X86_64
+        case SimdLevel::Avx2: pos = decodeAvx2(pos, end, ids); break;
+        case SimdLevel::Avx512: pos = decodeAvx512(pos, end, ids); break;
+#endif
+        default:
+            // Same fast path as the kernels, a pass at a time.
+            while (end - pos >= 12 && passLength(pos) != 0) {
+                ids.push_back(static_cast<uint16_t>(decodeSeat(pos)));
+                pos += passLength(pos);
+            }
+            break;
+        }
+
+        // Whatever the fast path couldn't take, a line at a time.
+        if (pos < end) {
+            pos = decodeLine(pos, end, ids);
+        }
+    }
+}
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "Simd.h"
+
+namespace aoc::y2020 {
+
+/**
+ * Boarding pass decoding straight from the input bytes.
+ *
+ * A pass is its seat ID in binary, most significant bit first, with F and L
+ * for 0 and B and R for 1. Bit 2 of those letters is set for F and L and
+ * clear for B and R, so every letter decodes as (~c >> 2) & 1 with no
+ * lookups or branches. Other bytes aren't rejected, they decode by the
+ * same rule.
+ **/
+
+// Seat ID of the 10 letter code starting at 'code'.
+inline uint32_t decodeSeat(const char* code)
+{
+    // The first 8 letters at once: bit 2 of each byte down to bit 0, then
+    // a multiply gathers those bits into the top byte, first letter highest.
+    uint64_t word;
+    std::memcpy(&word, code, sizeof(word));
+    auto bits = (~word >> 2) & 0x0101010101010101;
+    auto high = static_cast<uint32_t>((bits * 0x8040201008040201) >> 56);
+
+    auto low = ((~code[8] >> 2) & 1) << 1 | ((~code[9] >> 2) & 1);
+    return high << 2 | static_cast<uint32_t>(low);
+}
+
+// Appends the seat ID of every pass in the buffer, one per line, in order.
+// Blank lines are skipped, any other line must be exactly 10 letters or
+// std::runtime_error is thrown. Throws std::runtime_error if the level
+// isn't supported.
+void decodeSeats(std::string_view buffer, SimdLevel level, std::vector<uint16_t>& ids);
+
+}
@@ -0,0 +1,204 @@
+/**
+ * --- Day 5: Binary Boarding ---
+ * You board your plane only to discover a new problem: you dropped your boarding pass! You aren't sure which seat is yours, and all of the flight attendants are busy with the flood of people that suddenly made it through passport control.
+ * 
+ * You write a quick program to use your phone's camera to scan all of the nearby boarding passes (your puzzle input); perhaps you can find your seat through process of elimination.
+ * 
+ * Instead of zones or groups, this airline uses binary space partitioning to seat people. A seat might be specified like FBFBBFFRLR, where F means "front", B means "back", L means "left", and R means "right".
+ * 
+ * The first 7 characters will either be F or B; these specify exactly one of the 128 rows on the plane (numbered 0 through 127). Each letter tells you which half of a region the given seat is in. Start with the whole list of rows; the first letter indicates whether the seat is in the front (0 through 63) or the back (64 through 127). The next letter indicates which half of that region the seat is in, and so on until you're left with exactly one row.
+ * 
+ * For example, consider just the first seven characters of FBFBBFFRLR:
+ * 
+ * Start by considering the whole range, rows 0 through 127.
+ * F means to take the lower half, keeping rows 0 through 63.
+ * B means to take the upper half, keeping rows 32 through 63.
+ * F means to take the lower half, keeping rows 32 through 47.
+ * B means to take the upper half, keeping rows 40 through 47.
+ * B keeps rows 44 through 47.
+ * F keeps rows 44 through 45.
+ * The final F keeps the lower of the two, row 44.
+ * The last three characters will be either L or R; these specify exactly one of the 8 columns of seats on the plane (numbered 0 through 7). The same process as above proceeds again, this time with only three steps. L means to keep the lower half, while R means to keep the upper half.
+ * 
+ * For example, consider just the last 3 characters of FBFBBFFRLR:
+ * 
+ * Start by considering the whole range, columns 0 through 7.
+ * R means to take the upper half, keeping columns 4 through 7.
+ * L means to take the lower half, keeping columns 4 through 5.
+ * The final R keeps the upper of the two, column 5.
+ * So, decoding FBFBBFFRLR reveals that it is the seat at row 44, column 5.
+ * 
+ * Every seat also has a unique seat ID: multiply the row by 8, then add the column. In this example, the seat has ID 44 * 8 + 5 = 357.
+ * 
+ * Here are some other boarding passes:
+ * 
+ * BFFFBBFRRR: row 70, column 7, seat ID 567.
+ * FFFBBBFRRR: row 14, column 7, seat ID 119.
+ * BBFFBBFRLL: row 102, column 4, seat ID 820.
+ * As a sanity check, look through your list of boarding passes. What is the highest seat ID on a boarding pass?
+ * 
+ * --- Part Two ---
+ * Ding! The "fasten seat belt" signs have turned on. Time to find your seat.
+ * 
+ * It's a completely full flight, so your seat should be the only missing boarding pass in your list. However, there's a catch: some of the seats at the very front and back of the plane don't exist on this aircraft, so they'll be missing from your list as well.
+ * 
+ * Your seat wasn't at the very front or back, though; the seats with IDs +1 and -1 from yours will be in your list.
+ * 
+ * What is the ID of your seat?
+ **/
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Parallel.h"
+#include "SeatMap.h"
+#include "Year2020.h"
+
+namespace aoc::y2020 {
+
+namespace {
+
+// A flight as saved in the parse cache, its ID kept in a section of its own.
+struct CachedFlight
+{
+    uint64_t idOffset;
+    uint64_t idLength;
+    uint64_t passes;
+    uint32_t highest;
+    uint32_t reserved;
+    SeatMap seats;
+};
+
+class Day05 : public Solution
+{
+public:
+    void parse(const Input& input) override
+    {
+        // This is just binary w/ F/L as 0 and B/R as 1, decoded straight
+        // from the input without touching the letters.
+        // BFFFBBF RRR: row 70, column 7, seat ID 567.
+        // 1000110 111 -->  70,        7
+        // Each thread keeps its own highest ID and seat map per flight,
+        // merged once they're all done.
+        m_flights = scanFlights(input.data(), m_kernel, m_threads > 0 ? m_threads : hardwareThreads());
+    }
+
+    std::string part1() override
+    {
+        // seat ID : multiply the row by 8, then add the column
+        //  ... this is the same as row << 3  + col
+        //  ... or just leaving the 10 bits alone.
+        uint32_t p1Answer = 0;
+        for (const auto& flight : m_flights) {
+            p1Answer = std::max(p1Answer, flight.highest);
+        }
+
+        return std::to_string(p1Answer);
+    }
+
+    std::string part2() override
+    {
+        // the seats with IDs +1 and -1 from yours will be in your list
+        if (m_flights.size() == 1) {
+            return gapOf(m_flights.front());
+        }
+
+        // One seat per flight, as "<flight>=<seat>".
+        std::string p2Answer;
+        for (const auto& flight : m_flights) {
+            p2Answer += (p2Answer.empty() ? "" : ",") + flight.id + "=" + gapOf(flight);
+        }
+
+        return p2Answer;
+    }
+
+    // A few hundred bytes per flight, however many passes it took.
+    uint32_t cacheVersion() const override
+    {
+        return 1;
+    }
+
+    void saveParsed(ParseCacheWriter& cache) const override
+    {
+        std::vector<CachedFlight> flights;
+        std::string ids;
+        for (const auto& flight : m_flights) {
+            flights.push_back({ ids.size(), flight.id.size(), flight.passes, flight.highest, 0, flight.seats });
+            ids += flight.id;
+        }
+
+        cache.add(flights);
+        cache.add(std::span<const char>(ids));
+    }
+
+    void loadParsed(const ParseCache& cache, const Input& /*input*/) override
+    {
+        auto ids = cache.section<char>(1);
+        m_flights.clear();
+        for (const auto& cached : cache.section<CachedFlight>(0)) {
+            if (cached.idOffset > ids.size() || cached.idLength > ids.size() - cached.idOffset) {
+                throw std::runtime_error("Cached flight ID is out of range");
+            }
+
+            auto& flight = m_flights.emplace_back();
+            flight.id.assign(ids.data() + cached.idOffset, cached.idLength);
+            flight.highest = cached.highest;
+            flight.passes = cached.passes;
+            flight.seats = cached.seats;
+        }
+    }
+
+    // kernel=auto|scalar|avx2|avx512 picks the boarding pass decoder.
+    // threads=<n> decodes n chunks of the input at once (0 for one per
+    // core).
+    bool setOption(std::string_view key, std::string_view value) override
+    {
+        if (key == "kernel") {
+            if (!tryParseSimdLevel(value, m_kernel)) {
+                return false;
+            }
+            auto resolved = m_kernel;
+            if (!resolveSimdLevel(resolved)) {
+                throw std::runtime_error(std::string(value) + " is not supported on this CPU");
+            }
+            return true;
+        }
+        if (key == "threads") {
+            // The whole value, so "3abc" isn't taken as 3.
+            size_t threads = 0;
+            auto end = value.data() + value.size();
+            auto result = std::from_chars(value.data(), end, threads);
+            if (value.empty() || result.ec != std::errc() || result.ptr != end) {
+                return false;
+            }
+            m_threads = threads;
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    static std::string gapOf(const Flight& flight)
+    {
+        auto gap = flight.seats.findGap();
+        return gap ? std::to_string(*gap) : "none";
+    }
+
+    std::vector<Flight> m_flights;
+    SimdLevel m_kernel = SimdLevel::Auto;
+    size_t m_threads = 1;
+};
+
+}
+
+std::unique_ptr<Solution> makeDay05()
+{
+    return std::make_unique<Day05>();
+}
+
+}
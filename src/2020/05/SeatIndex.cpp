@@ -0,0 +1,146 @@
+#include "SeatIndex.h"
+
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+namespace aoc::y2020 {
+
+LayeredBits::LayeredBits(size_t size)
+    : m_size(size)
+{
+    auto words = (size + 63) / 64;
+    do {
+        m_levels.emplace_back(words, 0);
+        words = (words + 63) / 64;
+    } while (m_levels.back().size() > 1);
+}
+
+void LayeredBits::set(size_t pos)
+{
+    for (auto& level : m_levels) {
+        auto& word = level[pos >> 6];
+        auto wasEmpty = word == 0;
+        word |= uint64_t(1) << (pos & 63);
+        if (!wasEmpty) {
+            break;
+        }
+        pos >>= 6;
+    }
+}
+
+void LayeredBits::reset(size_t pos)
+{
+    for (auto& level : m_levels) {
+        auto& word = level[pos >> 6];
+        word &= ~(uint64_t(1) << (pos & 63));
+        if (word != 0) {
+            break;
+        }
+        pos >>= 6;
+    }
+}
+
+size_t LayeredBits::findNext(size_t pos) const
+{
+    if (pos >= m_size) {
+        return npos;
+    }
+
+    // Climb until a word has a set bit at or after pos, the next level up
+    // starting from the word after the one that had none.
+    size_t level = 0;
+    for (;;) {
+        const auto& words = m_levels[level];
+        auto idx = pos >> 6;
+        if (idx >= words.size()) {
+            return npos;
+        }
+
+        auto word = words[idx] & (~uint64_t(0) << (pos & 63));
+        if (word != 0) {
+            pos = idx * 64 + std::countr_zero(word);
+            break;
+        }
+        if (level + 1 == m_levels.size()) {
+            return npos;
+        }
+
+        pos = idx + 1;
+        ++level;
+    }
+
+    // Then take the lowest set bit on the way back down.
+    while (level > 0) {
+        --level;
+        pos = pos * 64 + std::countr_zero(m_levels[level][pos]);
+    }
+
+    return pos;
+}
+
+SeatIndex::SeatIndex(size_t seats)
+    : m_free(seats)
+    , m_gaps(seats)
+{
+    for (size_t seat = 0; seat < seats; ++seat) {
+        m_free.set(seat);
+    }
+}
+
+bool SeatIndex::insert(size_t seat)
+{
+    checkSeat(seat);
+    if (isTaken(seat)) {
+        return false;
+    }
+
+    m_free.reset(seat);
+    ++m_taken;
+    updateGap(seat);
+    if (seat > 0) {
+        updateGap(seat - 1);
+    }
+    if (seat + 1 < size()) {
+        updateGap(seat + 1);
+    }
+    return true;
+}
+
+bool SeatIndex::remove(size_t seat)
+{
+    checkSeat(seat);
+    if (!isTaken(seat)) {
+        return false;
+    }
+
+    m_free.set(seat);
+    --m_taken;
+    updateGap(seat);
+    if (seat > 0) {
+        updateGap(seat - 1);
+    }
+    if (seat + 1 < size()) {
+        updateGap(seat + 1);
+    }
+    return true;
+}
+
+void SeatIndex::checkSeat(size_t seat) const
+{
+    if (seat >= size()) {
+        throw std::out_of_range("Seat " + std::to_string(seat) + " on a flight of " + std::to_string(size()));
+    }
+}
+
+void SeatIndex::updateGap(size_t seat)
+{
+    auto gap = !isTaken(seat) && seat > 0 && isTaken(seat - 1) && seat + 1 < size() && isTaken(seat + 1);
+    if (gap) {
+        m_gaps.set(seat);
+    } else {
+        m_gaps.reset(seat);
+    }
+}
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aoc::y2020 {
+
+/**
+ * A bitset that can find the next set bit in O(log_64 n).
+ *
+ * Above the bits sit summary levels, where bit i of a level says whether
+ * word i of the level below has any bit set, until a level fits in one
+ * word. set() and reset() only climb while a word changes between empty
+ * and non-empty, and findNext() climbs just far enough to skip the empty
+ * words before coming back down.
+ **/
+class LayeredBits
+{
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // 'size' bits, all clear.
+    explicit LayeredBits(size_t size);
+
+    size_t size() const { return m_size; }
+
+    bool test(size_t pos) const { return (m_levels[0][pos >> 6] >> (pos & 63)) & 1; }
+    void set(size_t pos);
+    void reset(size_t pos);
+
+    // The first set bit at or after pos, or npos.
+    size_t findNext(size_t pos) const;
+
+private:
+    size_t m_size = 0;
+    std::vector<std::vector<uint64_t>> m_levels;
+};
+
+/**
+ * Live seat bookings for one flight of any size.
+ *
+ * Where SeatMap answers Part 2 once for a finished list of passes, this
+ * keeps the answer current while seats are booked and cancelled. Free
+ * seats and gaps (free seats with both neighbours taken, seats past either
+ * end never are) are kept in a LayeredBits each. A booking or cancellation
+ * touches the gap bits of three seats at most.
+ **/
+class SeatIndex
+{
+public:
+    static constexpr size_t npos = LayeredBits::npos;
+
+    // 'seats' seats, all free.
+    explicit SeatIndex(size_t seats);
+
+    size_t size() const { return m_free.size(); }
+    size_t taken() const { return m_taken; }
+
+    bool isTaken(size_t seat) const { return !m_free.test(seat); }
+
+    // Both return false, and change nothing, if the seat was already in
+    // that state. Throws std::out_of_range past the last seat.
+    bool insert(size_t seat);
+    bool remove(size_t seat);
+
+    // The first free seat at or after 'from', or npos.
+    size_t nextFree(size_t from = 0) const { return m_free.findNext(from); }
+
+    // The first gap at or after 'from', or npos.
+    size_t nextGap(size_t from = 0) const { return m_gaps.findNext(from); }
+
+private:
+    void checkSeat(size_t seat) const;
+    void updateGap(size_t seat);
+
+    // Set for free seats, so nextFree() is a plain findNext().
+    LayeredBits m_free;
+    LayeredBits m_gaps;
+    size_t m_taken = 0;
+};
+
+}
@@ -0,0 +1,152 @@
+#include "SeatMap.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "BoardingPass.h"
+#include "Input.h"
+#include "Parallel.h"
+
+namespace aoc::y2020 {
+
+void SeatMap::merge(const SeatMap& other)
+{
+    for (size_t idx = 0; idx < m_words.size(); ++idx) {
+        m_words[idx] |= other.m_words[idx];
+    }
+}
+
+std::optional<uint32_t> SeatMap::findGap() const
+{
+    for (size_t idx = 0; idx < m_words.size(); ++idx) {
+        auto word = m_words[idx];
+
+        // Shift the neighbours of every seat into its own bit, carrying
+        // across words. Seats past either end of the plane are never taken.
+        auto below = word << 1 | (idx > 0 ? m_words[idx - 1] >> 63 : 0);
+        auto above = word >> 1 | (idx + 1 < m_words.size() ? m_words[idx + 1] << 63 : 0);
+        auto gaps = ~word & below & above;
+        if (gaps != 0) {
+            return static_cast<uint32_t>(idx * 64 + std::countr_zero(gaps));
+        }
+    }
+
+    return std::nullopt;
+}
+
+namespace {
+
+// Passes decoded per batch, so the IDs are still in cache when folded in.
+constexpr size_t batchBytes = 64 * 1024;
+
+void addSeat(Flight& flight, uint32_t seat)
+{
+    flight.highest = std::max(flight.highest, seat);
+    flight.seats.set(seat);
+    ++flight.passes;
+}
+
+// Bare passes all belong to one flight, so the fast decoders can run over
+// the chunk a batch at a time.
+void scanBare(std::string_view chunk, SimdLevel level, Flight& flight)
+{
+    std::vector<uint16_t> seats;
+    while (!chunk.empty()) {
+        auto newline = chunk.size() > batchBytes ? chunk.find('\n', batchBytes) : std::string_view::npos;
+        auto batch = chunk.substr(0, newline == std::string_view::npos ? chunk.size() : newline + 1);
+        chunk.remove_prefix(batch.size());
+
+        seats.clear();
+        decodeSeats(batch, level, seats);
+        for (auto seat : seats) {
+            addSeat(flight, seat);
+        }
+    }
+}
+
+struct ChunkFlights
+{
+    std::unordered_map<std::string_view, size_t> index;
+    std::vector<std::string_view> ids;
+    std::vector<Flight> flights;
+
+    Flight& operator[](std::string_view id)
+    {
+        auto [it, inserted] = index.emplace(id, flights.size());
+        if (inserted) {
+            ids.push_back(id);
+            flights.emplace_back();
+        }
+        return flights[it->second];
+    }
+};
+
+void scanKeyed(std::string_view chunk, ChunkFlights& flights)
+{
+    for (auto line : LineRange(chunk, false)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        // The pass is the last column, everything before it names the flight.
+        auto split = line.find_last_of(" \t");
+        auto pass = split == std::string_view::npos ? line : line.substr(split + 1);
+        auto id = split == std::string_view::npos ? std::string_view() : line.substr(0, split);
+        id = id.substr(0, id.find_last_not_of(" \t") + 1);
+        if (pass.size() != 10) {
+            throw std::runtime_error("Bad boarding pass: " + std::string(line));
+        }
+
+        addSeat(flights[id], decodeSeat(pass.data()));
+    }
+}
+
+}
+
+std::vector<Flight> scanFlights(std::string_view buffer, SimdLevel level, size_t threads)
+{
+    auto keyed = false;
+    for (auto line : LineRange(buffer, false)) {
+        if (!line.empty()) {
+            keyed = line.size() != 10;
+            break;
+        }
+    }
+
+    auto chunks = splitAtNewlines(buffer, threads);
+    std::vector<ChunkFlights> chunkFlights(chunks.size());
+    parallelFor(chunks.size(), [&](size_t idx) {
+        if (keyed) {
+            scanKeyed(chunks[idx], chunkFlights[idx]);
+        } else {
+            scanBare(chunks[idx], level, chunkFlights[idx][std::string_view()]);
+        }
+    });
+
+    // Chunk order, then order within the chunk, is input order.
+    std::unordered_map<std::string_view, size_t> index;
+    std::vector<Flight> flights;
+    for (auto& chunk : chunkFlights) {
+        for (size_t local = 0; local < chunk.flights.size(); ++local) {
+            auto& from = chunk.flights[local];
+            auto [it, inserted] = index.emplace(chunk.ids[local], flights.size());
+            if (inserted) {
+                flights.push_back(std::move(from));
+                flights.back().id = chunk.ids[local];
+                continue;
+            }
+
+            auto& into = flights[it->second];
+            into.highest = std::max(into.highest, from.highest);
+            into.passes += from.passes;
+            into.seats.merge(from.seats);
+        }
+    }
+
+    return flights;
+}
+
+}
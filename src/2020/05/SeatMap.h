@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Simd.h"
+
+namespace aoc::y2020 {
+
+/**
+ * The seats taken on one flight, one bit per possible seat ID.
+ *
+ * Maps built from different parts of the input are combined with merge(),
+ * a word-wide OR, so threads never share one while filling it.
+ **/
+class SeatMap
+{
+public:
+    // Every 10 letter pass, 128 rows of 8 seats.
+    static constexpr size_t seatCount = 1024;
+
+    void set(uint32_t seat) { m_words[seat >> 6] |= uint64_t(1) << (seat & 63); }
+    bool test(uint32_t seat) const { return (m_words[seat >> 6] >> (seat & 63)) & 1; }
+
+    void merge(const SeatMap& other);
+
+    // The lowest free seat whose neighbours on both sides are taken.
+    std::optional<uint32_t> findGap() const;
+
+private:
+    std::array<uint64_t, seatCount / 64> m_words = {};
+};
+
+// Everything the passes say about one flight.
+struct Flight
+{
+    // Empty for passes without a flight column.
+    std::string id;
+    uint32_t highest = 0;
+    size_t passes = 0;
+    SeatMap seats;
+};
+
+// Decodes every pass in the buffer, split into 'threads' chunks decoded in
+// parallel. A line is either a bare pass or "<flight> <pass>", decided by
+// the first line. Flights come back in order of first appearance. Throws
+// std::runtime_error on a malformed line.
+std::vector<Flight> scanFlights(std::string_view buffer, SimdLevel level, size_t threads);
+
+}
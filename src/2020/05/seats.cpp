@@ -0,0 +1,131 @@
+/**
+ * Benchmarks SeatIndex on a stream of random bookings, cancellations and
+ * queries.
+ *
+ *   2020_05_seats [--seats <n>] [--ops <n>] [--seed <n>] [--verify]
+ *
+ * Defaults to a million seats and ten million operations: 40% bookings,
+ * 30% cancellations, 15% "next free seat at or after k" and 15% "next gap
+ * at or after k", all at random seats. --verify repeats every answer with
+ * a linear scan, which is only practical for small flights.
+ **/
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SeatIndex.h"
+
+namespace {
+
+// What the index should have answered, by brute force.
+size_t scanFree(const std::vector<bool>& taken, size_t from)
+{
+    for (auto seat = from; seat < taken.size(); ++seat) {
+        if (!taken[seat]) {
+            return seat;
+        }
+    }
+    return aoc::y2020::SeatIndex::npos;
+}
+
+size_t scanGap(const std::vector<bool>& taken, size_t from)
+{
+    for (auto seat = std::max<size_t>(from, 1); seat + 1 < taken.size(); ++seat) {
+        if (!taken[seat] && taken[seat - 1] && taken[seat + 1]) {
+            return seat;
+        }
+    }
+    return aoc::y2020::SeatIndex::npos;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    size_t seats = 1000000;
+    size_t ops = 10000000;
+    uint64_t seed = 2020;
+    auto verify = false;
+    try {
+        for (auto idx = 1; idx < argc; ++idx) {
+            std::string arg = argv[idx];
+            if (arg == "--seats" && idx + 1 < argc) {
+                seats = std::stoull(argv[++idx]);
+            } else if (arg == "--ops" && idx + 1 < argc) {
+                ops = std::stoull(argv[++idx]);
+            } else if (arg == "--seed" && idx + 1 < argc) {
+                seed = std::stoull(argv[++idx]);
+            } else if (arg == "--verify") {
+                verify = true;
+            } else {
+                std::cerr << "Usage: " << argv[0] << " [--seats <n>] [--ops <n>] [--seed <n>] [--verify]" << std::endl;
+                return 1;
+            }
+        }
+        if (seats == 0) {
+            throw std::invalid_argument("--seats must be at least 1");
+        }
+
+        // Drawn up front so the timing is the index alone.
+        std::mt19937_64 random(seed);
+        std::vector<uint32_t> kinds(ops);
+        std::vector<size_t> targets(ops);
+        for (size_t op = 0; op < ops; ++op) {
+            kinds[op] = random() % 100;
+            targets[op] = random() % seats;
+        }
+
+        aoc::y2020::SeatIndex index(seats);
+        std::vector<bool> taken(verify ? seats : 0);
+        size_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t op = 0; op < ops; ++op) {
+            auto kind = kinds[op];
+            auto seat = targets[op];
+            size_t answer = 0;
+            size_t expected = 0;
+            if (kind < 40) {
+                answer = index.insert(seat);
+                expected = verify && !taken[seat];
+                if (verify) {
+                    taken[seat] = true;
+                }
+            } else if (kind < 70) {
+                answer = index.remove(seat);
+                expected = verify && taken[seat];
+                if (verify) {
+                    taken[seat] = false;
+                }
+            } else if (kind < 85) {
+                answer = index.nextFree(seat);
+                expected = verify ? scanFree(taken, seat) : 0;
+            } else {
+                answer = index.nextGap(seat);
+                expected = verify ? scanGap(taken, seat) : 0;
+            }
+
+            if (verify && answer != expected) {
+                throw std::runtime_error(
+                    "Operation " + std::to_string(op) + " answered " + std::to_string(answer) + ", expected "
+                    + std::to_string(expected));
+            }
+            checksum += answer;
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout
+            << ops << " operations on " << seats << " seats in " << elapsed * 1000 << "ms ("
+            << ops / elapsed / 1e6 << "M ops/s), " << index.taken() << " taken, checksum " << checksum << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
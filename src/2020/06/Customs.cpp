@@ -0,0 +1,192 @@
+#include "Customs.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace aoc::y2020 {
+
+namespace {
+
+// A line of nothing, or of just the '\r' of a CRLF.
+bool isBlank(const char* line, size_t length)
+{
+    return length == 0 || (length == 1 && line[0] == '\r');
+}
+
+#if AOC_X86_64
+
+// One line per iteration, for as long as a 32 byte load at the start of the
+// line stays in the buffer and reaches its newline. Returns where it
+// stopped for the scalar path to take over.
+AOC_TARGET("avx2")
+const char* feedAvx2(const char* pos, const char* end, CustomsTally& tally)
+{
+    auto local = tally;
+    const auto newline = _mm256_set1_epi8('\n');
+    const auto first = _mm256_set1_epi8('a');
+    const auto outside = _mm256_set1_epi8(-1);
+    const auto one = _mm256_set1_epi32(1);
+    const auto index = _mm256_setr_epi8(
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+
+    while (end - pos >= 32) {
+        auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos));
+        auto newlines = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, newline)));
+        if (newlines == 0) {
+            break;
+        }
+
+        auto length = std::countr_zero(newlines);
+        if (isBlank(pos, length)) {
+            local.endGroup();
+            pos += length + 1;
+            continue;
+        }
+
+        // Question numbers, with everything from the newline on pushed to
+        // 255, which like any non-letter shifts the 1 out of the lane.
+        auto inLine = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(length)), index);
+        auto questions = _mm256_or_si256(_mm256_sub_epi8(bytes, first), _mm256_andnot_si256(inLine, outside));
+
+        auto low = _mm256_castsi256_si128(questions);
+        auto high = _mm256_extracti128_si256(questions, 1);
+        auto bits = _mm256_or_si256(
+            _mm256_or_si256(
+                _mm256_sllv_epi32(one, _mm256_cvtepu8_epi32(low)),
+                _mm256_sllv_epi32(one, _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)))),
+            _mm256_or_si256(
+                _mm256_sllv_epi32(one, _mm256_cvtepu8_epi32(high)),
+                _mm256_sllv_epi32(one, _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)))));
+
+        auto lanes = _mm_or_si128(_mm256_castsi256_si128(bits), _mm256_extracti128_si256(bits, 1));
+        lanes = _mm_or_si128(lanes, _mm_shuffle_epi32(lanes, 0x4E));
+        lanes = _mm_or_si128(lanes, _mm_shuffle_epi32(lanes, 0xB1));
+        local.addPerson(static_cast<uint32_t>(_mm_cvtsi128_si32(lanes)) & allQuestions);
+        pos += length + 1;
+    }
+
+    tally = local;
+    return pos;
+}
+
+// As above, with mask registers for the line bounds and the lane reduction.
+AOC_TARGET("avx512f,avx512bw,avx512vl")
+const char* feedAvx512(const char* pos, const char* end, CustomsTally& tally)
+{
+    auto local = tally;
+    const auto newline = _mm256_set1_epi8('\n');
+    const auto first = _mm256_set1_epi8('a');
+    const auto one = _mm512_set1_epi32(1);
+
+    while (end - pos >= 32) {
+        auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos));
+        auto newlines = static_cast<uint32_t>(_mm256_cmpeq_epi8_mask(bytes, newline));
+        if (newlines == 0) {
+            break;
+        }
+
+        auto length = std::countr_zero(newlines);
+        if (isBlank(pos, length)) {
+            local.endGroup();
+            pos += length + 1;
+            continue;
+        }
+
+        auto inLine = (uint32_t(1) << length) - 1;
+        auto questions = _mm256_sub_epi8(bytes, first);
+        auto bits = _mm512_or_si512(
+            _mm512_maskz_sllv_epi32(
+                static_cast<__mmask16>(inLine), one, _mm512_cvtepu8_epi32(_mm256_castsi256_si128(questions))),
+            _mm512_maskz_sllv_epi32(
+                static_cast<__mmask16>(inLine >> 16), one,
+                _mm512_cvtepu8_epi32(_mm256_extracti128_si256(questions, 1))));
+
+        local.addPerson(static_cast<uint32_t>(_mm512_reduce_or_epi32(bits)) & allQuestions);
+        pos += length + 1;
+    }
+
+    tally = local;
+    return pos;
+}
+
+#endif
+
+}
+
+CustomsCounter::CustomsCounter(SimdLevel level)
+    : m_level(level)
+{
+    if (!resolveSimdLevel(m_level)) {
+        throw std::runtime_error("Customs kernel is not supported on this CPU");
+    }
+}
+
+void CustomsCounter::feed(std::string_view text)
+{
+    auto pos = text.data();
+    auto end = text.data() + text.size();
+    if (m_partial) {
+        auto newline = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+        extendLine(pos, newline ? newline : end);
+        if (newline == nullptr) {
+            return;
+        }
+        endLine();
+        pos = newline + 1;
+    }
+
+    while (pos < end) {
+        switch (m_level) {
+#if AOC_X86_64
+        case SimdLevel::Avx2: pos = feedAvx2(pos, end, m_tally); break;
+        case SimdLevel::Avx512: pos = feedAvx512(pos, end, m_tally); break;
+#endif
+        default: break;
+        }
+
+        // Lines too long for a kernel and the last few near the end.
+        if (pos < end) {
+            auto newline = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+            extendLine(pos, newline ? newline : end);
+            if (newline == nullptr) {
+                return;
+            }
+            endLine();
+            pos = newline + 1;
+        }
+    }
+}
+
+void CustomsCounter::finish()
+{
+    if (m_partial) {
+        endLine();
+    }
+    m_tally.endGroup();
+}
+
+void CustomsCounter::extendLine(const char* begin, const char* end)
+{
+    if (m_partialLength == 0 && begin != end) {
+        m_partialCr = *begin == '\r';
+    }
+    m_partial = true;
+    m_partialMask |= answerMask(std::string_view(begin, end - begin));
+    m_partialLength += end - begin;
+}
+
+void CustomsCounter::endLine()
+{
+    if (m_partialLength == 0 || (m_partialLength == 1 && m_partialCr)) {
+        m_tally.endGroup();
+    } else {
+        m_tally.addPerson(m_partialMask);
+    }
+
+    m_partial = false;
+    m_partialMask = 0;
+    m_partialLength = 0;
+}
+
+}
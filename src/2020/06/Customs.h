@@ -0,0 +1,106 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Simd.h"
+
+namespace aoc::y2020 {
+
+// One bit per question, 'a' in bit 0.
+constexpr uint32_t allQuestions = (uint32_t(1) << 26) - 1;
+
+// The questions one person answered yes to. Anything but 'a' to 'z' is
+// ignored, which takes care of a trailing '\r'.
+inline uint32_t answerMask(std::string_view line)
+{
+    uint32_t mask = 0;
+    for (auto c : line) {
+        auto question = static_cast<uint8_t>(c - 'a');
+        mask |= question < 26 ? uint32_t(1) << question : 0;
+    }
+    return mask;
+}
+
+// Totals over the finished groups, plus the group still being read.
+struct CustomsTally
+{
+    size_t anyone = 0;
+    size_t everyone = 0;
+    size_t groups = 0;
+
+    uint32_t groupAnyone = 0;
+    uint32_t groupEveryone = allQuestions;
+    size_t groupPeople = 0;
+
+    void addPerson(uint32_t answers)
+    {
+        groupAnyone |= answers;
+        groupEveryone &= answers;
+        ++groupPeople;
+    }
+
+    // A blank line, or the end of the input. Does nothing between groups.
+    void endGroup()
+    {
+        if (groupPeople != 0) {
+            anyone += std::popcount(groupAnyone);
+            everyone += std::popcount(groupEveryone);
+            ++groups;
+        }
+        groupAnyone = 0;
+        groupEveryone = allQuestions;
+        groupPeople = 0;
+    }
+};
+
+/**
+ * Counts Day 6's answers in one pass over the raw input, keeping nothing
+ * per group but two masks.
+ *
+ * For each group, Part 1 wants the number of questions anyone answered yes
+ * to, the popcount of the OR of everyone's masks, and Part 2 the number
+ * everyone did, the popcount of the AND. The SIMD kernels find the end of
+ * a line and turn its letters into a mask from the same 32 byte load,
+ * shifting a 1 into place for every letter in its own 32-bit lane and
+ * ORing the lanes together.
+ *
+ * Input can be fed in pieces cut anywhere, a line split between pieces is
+ * carried over as its mask so far, so memory use doesn't depend on the
+ * size of the input or of its lines.
+ **/
+class CustomsCounter
+{
+public:
+    // Throws std::runtime_error if the level isn't supported.
+    explicit CustomsCounter(SimdLevel level = SimdLevel::Auto);
+
+    // The next piece of input, whatever follows the last newline is held
+    // until the next piece or finish().
+    void feed(std::string_view text);
+
+    // Takes the last line even without a newline and closes the last group.
+    // Feeding more afterwards starts a new one.
+    void finish();
+
+    size_t anyone() const { return m_tally.anyone; }
+    size_t everyone() const { return m_tally.everyone; }
+    size_t groups() const { return m_tally.groups; }
+
+private:
+    void extendLine(const char* begin, const char* end);
+    void endLine();
+
+    SimdLevel m_level;
+    CustomsTally m_tally;
+
+    // The line cut off at the end of the last piece.
+    bool m_partial = false;
+    uint32_t m_partialMask = 0;
+    size_t m_partialLength = 0;
+    bool m_partialCr = false;
+};
+
+}
@@ -73,74 +73,69 @@
  * For each group, count the number of questions to which everyone answered "yes". What is the sum of those counts?
  **/
 
-#include <bitset>
-#include <chrono>
-#include <fstream>
-#include <iostream>
+#include <stdexcept>
 #include <string>
-#include <vector>
 
-size_t countAllAnsweredYes(const std::vector<std::bitset<26>>& groupAnswers) {
-    std::bitset<26> allAnsweredYes;
-    allAnsweredYes.set();
-    for (auto individualAnswers : groupAnswers) {
-        allAnsweredYes &= individualAnswers;
-    }
+#include "Customs.h"
+#include "Year2020.h"
 
-    return allAnsweredYes.count();
-}
+namespace aoc::y2020 {
 
-int main(int argc, char** argv)
-{
-    auto start = std::chrono::high_resolution_clock::now();
+namespace {
 
-    // Read file
-    std::ifstream inputFile("input.txt");
-    std::string line;
-    std::vector<std::string> inputData;
-    bool startNextEntry = true;
-    while (std::getline(inputFile, line)) {
-        inputData.push_back(line);
+class Day06 : public Solution
+{
+public:
+    void parse(const Input& input) override
+    {
+        // Both parts in one pass, only the totals are kept.
+        CustomsCounter counter(m_kernel);
+        counter.feed(input.data());
+        counter.finish();
+        m_anyone = counter.anyone();
+        m_everyone = counter.everyone();
     }
-    inputFile.close();
 
-    auto t1 = std::chrono::high_resolution_clock::now();
+    std::string part1() override
+    {
+        // Questions anyone in the group answered, so the union of the group
+        // and not the sum over its people.
+        return std::to_string(m_anyone);
+    }
 
-    // Part 1 & 2
-    auto p1Answer = 0;
-    auto p2Answer = 0;
-    std::vector<std::bitset<26>> groupAnswers;
-    for (auto data : inputData) {
-        if (data.length() == 0) {
-            // End of group, update P2 answer and reset.
-            p2Answer += countAllAnsweredYes(groupAnswers);
-            groupAnswers.clear();
-            continue;
-        }
+    std::string part2() override
+    {
+        return std::to_string(m_everyone);
+    }
 
-        std::bitset<26> answers;
-        for each (auto question in data)
-        {
-            answers.set(question - 'a'); // offset values so 'a' is 0 and 'z' is 25
+    // kernel=auto|scalar|avx2|avx512 picks the line to mask kernel.
+    bool setOption(std::string_view key, std::string_view value) override
+    {
+        if (key == "kernel") {
+            if (!tryParseSimdLevel(value, m_kernel)) {
+                return false;
+            }
+            auto resolved = m_kernel;
+            if (!resolveSimdLevel(resolved)) {
+                throw std::runtime_error(std::string(value) + " is not supported on this CPU");
+            }
+            return true;
         }
 
-        // Update P1 answer & add to group for P2 answer.
-        p1Answer += answers.count();
-        groupAnswers.push_back(std::move(answers));
+        return false;
     }
 
-    // Don't forget the last group
-    p2Answer += countAllAnsweredYes(groupAnswers);
+private:
+    SimdLevel m_kernel = SimdLevel::Auto;
+    size_t m_anyone = 0;
+    size_t m_everyone = 0;
+};
 
-    auto t2 = std::chrono::high_resolution_clock::now();
+}
 
-    auto fileLoad = std::chrono::duration_cast<std::chrono::microseconds>(t1 - start).count();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
-    auto totalTime = std::chrono::duration_cast<std::chrono::microseconds>(t2 - start).count();
+std::unique_ptr<Solution> makeDay06()
+{
+    return std::make_unique<Day06>();
+}
 
-    std::cout
-        << std::endl
-        << "File Load: " << fileLoad << "us" << std::endl
-        << "Part1: " << p1Answer << ", Part2: " << p2Answer << " (" << duration << "us)" << std::endl
-        << "Total Time: " << totalTime << "us" << std::endl;
-}
\ No newline at end of file
+}
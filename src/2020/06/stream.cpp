@@ -0,0 +1,73 @@
+/**
+ * Day 6 over a stream of customs declarations of any size, in constant
+ * memory.
+ *
+ *   2020_06_stream [file] [--block <bytes>] [--kernel auto|scalar|avx2|avx512]
+ *
+ * Reads stdin unless given a file, a block at a time (4096 bytes unless
+ * --block says otherwise), and feeds each block to CustomsCounter as read,
+ * so lines and groups may span blocks. Prints both answers, the group count
+ * and the throughput.
+ *
+ * That figure covers reading as well as counting, over a stream read once, so
+ * it measures the tool end to end. The runner's Benchmark is what times the
+ * day's phases.
+ **/
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "Customs.h"
+#include "LineStream.h"
+
+int main(int argc, char** argv)
+{
+    std::string path = "-";
+    size_t blockSize = 4096;
+    auto kernel = aoc::SimdLevel::Auto;
+    try {
+        for (auto idx = 1; idx < argc; ++idx) {
+            std::string arg = argv[idx];
+            if (arg == "--block" && idx + 1 < argc) {
+                blockSize = std::stoull(argv[++idx]);
+            } else if (arg == "--kernel" && idx + 1 < argc) {
+                if (!aoc::tryParseSimdLevel(argv[++idx], kernel)) {
+                    throw std::invalid_argument(std::string("Unknown kernel ") + argv[idx]);
+                }
+            } else {
+                path = arg;
+            }
+        }
+        if (blockSize == 0) {
+            throw std::invalid_argument("--block must be at least 1");
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        aoc::y2020::CustomsCounter counter(kernel);
+        aoc::LineStream stream(path, blockSize);
+        size_t bytes = 0;
+        std::string_view block;
+        while (stream.nextBlock(block)) {
+            counter.feed(block);
+            bytes += block.size();
+        }
+        counter.finish();
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout
+            << "Part1: " << counter.anyone() << std::endl
+            << "Part2: " << counter.everyone() << std::endl
+            << "Groups: " << counter.groups() << " in " << bytes << " bytes, " << stream.capacity() << " buffered"
+            << " (" << static_cast<int64_t>(elapsed * 1e6) << "us, "
+            << static_cast<int64_t>(bytes / std::max(elapsed, 1e-9) / 1e6) << " MB/s)" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
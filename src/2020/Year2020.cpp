@@ -0,0 +1,19 @@
+#include "Year2020.h"
+
+namespace aoc::y2020 {
+
+const std::vector<Day>& days()
+{
+    static const std::vector<Day> days = {
+        { 2020, 1, "Report Repair",        makeDay01 },
+        { 2020, 2, "Password Philosophy",  makeDay02 },
+        { 2020, 3, "Toboggan Trajectory",  makeDay03 },
+        { 2020, 4, "Passport Processing",  makeDay04 },
+        { 2020, 5, "Binary Boarding",      makeDay05 },
+        { 2020, 6, "Custom Customs",       makeDay06 },
+    };
+
+    return days;
+}
+
+}
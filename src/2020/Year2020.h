@@ -0,0 +1,20 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "Solution.h"
+
+namespace aoc::y2020 {
+
+std::unique_ptr<Solution> makeDay01();
+std::unique_ptr<Solution> makeDay02();
+std::unique_ptr<Solution> makeDay03();
+std::unique_ptr<Solution> makeDay04();
+std::unique_ptr<Solution> makeDay05();
+std::unique_ptr<Solution> makeDay06();
+
+// Every solved day of the year, in order.
+const std::vector<Day>& days();
+
+}
@@ -0,0 +1,137 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+namespace aoc {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Calibration
+{
+    int64_t overhead;
+    int64_t resolution;
+};
+
+// Reads the clock back to back a few thousand times. The median gap is the
+// cost of one reading, the smallest non-zero gap is the clock's step size.
+Calibration calibrate()
+{
+    constexpr auto samples = 4096;
+    std::vector<int64_t> deltas;
+    deltas.reserve(samples);
+
+    for (auto idx = 0; idx < samples; ++idx) {
+        auto t1 = Clock::now();
+        auto t2 = Clock::now();
+        deltas.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+    }
+
+    std::sort(deltas.begin(), deltas.end());
+    auto firstStep = std::upper_bound(deltas.begin(), deltas.end(), 0);
+    auto resolution = firstStep != deltas.end()
+        ? *firstStep
+        : std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::duration(1)).count();
+
+    return { deltas[deltas.size() / 2], std::max<int64_t>(resolution, 1) };
+}
+
+const Calibration& calibration()
+{
+    static const Calibration result = calibrate();
+    return result;
+}
+
+// Nearest-rank percentile of sorted samples.
+int64_t percentile(const std::vector<int64_t>& sorted, double p)
+{
+    auto rank = static_cast<size_t>(std::ceil(p * sorted.size()));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+}
+
+Stats Stats::fromSamples(std::vector<int64_t> samples)
+{
+    Stats stats;
+    if (samples.empty()) {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    stats.runs = samples.size();
+    stats.min = samples.front();
+    stats.max = samples.back();
+    stats.median = percentile(samples, 0.5);
+    stats.p90 = percentile(samples, 0.9);
+    stats.p99 = percentile(samples, 0.99);
+    stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+
+    auto variance = 0.0;
+    for (auto sample : samples) {
+        variance += (sample - stats.mean) * (sample - stats.mean);
+    }
+    stats.stddev = samples.size() > 1 ? std::sqrt(variance / (samples.size() - 1)) : 0.0;
+
+    return stats;
+}
+
+Benchmark::Benchmark(int warmup, int runs)
+    : m_warmup(std::max(warmup, 0))
+    , m_runs(std::max(runs, 1))
+{}
+
+std::vector<Stats> Benchmark::run(const std::vector<Phase>& phases) const
+{
+    auto overhead = clockOverhead();
+
+    // One row of samples per phase, plus one for the iteration total.
+    std::vector<std::vector<int64_t>> samples(phases.size() + 1);
+    for (auto& row : samples) {
+        row.reserve(m_runs);
+    }
+
+    for (auto iteration = 0; iteration < m_warmup + m_runs; ++iteration) {
+        int64_t total = 0;
+        for (size_t idx = 0; idx < phases.size(); ++idx) {
+            auto start = Clock::now();
+            phases[idx].run();
+            auto end = Clock::now();
+
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            elapsed = std::max<int64_t>(elapsed - overhead, 0);
+            total += elapsed;
+
+            if (iteration >= m_warmup) {
+                samples[idx].push_back(elapsed);
+            }
+        }
+
+        if (iteration >= m_warmup) {
+            samples.back().push_back(total);
+        }
+    }
+
+    std::vector<Stats> stats;
+    for (auto& row : samples) {
+        stats.push_back(Stats::fromSamples(std::move(row)));
+    }
+
+    return stats;
+}
+
+int64_t Benchmark::clockOverhead()
+{
+    return calibration().overhead;
+}
+
+int64_t Benchmark::clockResolution()
+{
+    return calibration().resolution;
+}
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace aoc {
+
+// Summary of a set of timing samples, all in nanoseconds.
+struct Stats
+{
+    size_t runs = 0;
+    int64_t min = 0;
+    int64_t median = 0;
+    int64_t p90 = 0;
+    int64_t p99 = 0;
+    int64_t max = 0;
+    double mean = 0;
+    double stddev = 0;
+
+    static Stats fromSamples(std::vector<int64_t> samples);
+};
+
+struct Phase
+{
+    std::string name;
+    std::function<void()> run;
+};
+
+/**
+ * Times a sequence of phases over many iterations.
+ *
+ * Every iteration runs all phases in order, so later phases can depend on
+ * earlier ones the same way they do in a normal run. The first 'warmup'
+ * iterations are thrown away to get past first-touch page faults and cold
+ * caches.
+ *
+ * Samples come from std::chrono::steady_clock with the measured cost of
+ * reading the clock subtracted.
+ **/
+class Benchmark
+{
+public:
+    Benchmark(int warmup, int runs);
+
+    // Returns stats for each phase in order, followed by the per-iteration total.
+    std::vector<Stats> run(const std::vector<Phase>& phases) const;
+
+    // Cost of a single now() call and the smallest step the clock can make, in ns.
+    static int64_t clockOverhead();
+    static int64_t clockResolution();
+
+private:
+    int m_warmup;
+    int m_runs;
+};
+
+}
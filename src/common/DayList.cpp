@@ -0,0 +1,76 @@
+#include "DayList.h"
+
+#include <charconv>
+#include <stdexcept>
+#include <string_view>
+
+namespace aoc {
+
+namespace {
+
+// The whole of 'text' as a number, 'item' is what the error names.
+int parseNumber(std::string_view text, std::string_view item, const char* what)
+{
+    int value = 0;
+    auto end = text.data() + text.size();
+    auto result = std::from_chars(text.data(), end, value);
+    if (text.empty() || result.ec != std::errc() || result.ptr != end) {
+        throw std::invalid_argument(std::string("Bad ") + what + " \"" + std::string(item) + "\"");
+    }
+
+    return value;
+}
+
+}
+
+std::set<int> parseDayList(const std::string& spec)
+{
+    std::set<int> days;
+    std::string_view rest(spec);
+    for (;;) {
+        auto comma = rest.find(',');
+        auto item = rest.substr(0, comma);
+        auto dash = item.find('-');
+        auto first = parseNumber(item.substr(0, dash), item, "day");
+        auto last = dash == std::string_view::npos ? first : parseNumber(item.substr(dash + 1), item, "day");
+        if (first < 1 || last > 25 || first > last) {
+            throw std::invalid_argument("Bad day \"" + std::string(item) + "\", days run from 1 to 25");
+        }
+
+        for (auto day = first; day <= last; ++day) {
+            days.insert(day);
+        }
+
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        rest.remove_prefix(comma + 1);
+    }
+
+    return days;
+}
+
+int parseYear(const std::string& text)
+{
+    auto year = parseNumber(text, text, "year");
+    if (year < 2015) {
+        throw std::invalid_argument("Bad year \"" + text + "\", the first Advent of Code was 2015");
+    }
+
+    return year;
+}
+
+uint64_t parseCount(const std::string& option, const std::string& text, uint64_t min)
+{
+    uint64_t value = 0;
+    auto end = text.data() + text.size();
+    auto result = std::from_chars(text.data(), end, value);
+    if (text.empty() || result.ec != std::errc() || result.ptr != end || value < min) {
+        throw std::invalid_argument(
+            "Bad " + option + " \"" + text + "\", expected a whole number of at least " + std::to_string(min));
+    }
+
+    return value;
+}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <string>
+
+namespace aoc {
+
+// Parses a day selection such as "1-3,5" into { 1, 2, 3, 5 }. Throws
+// std::invalid_argument naming the bad item if one isn't a number or a
+// range of them, or falls outside days 1 to 25, or runs backwards.
+std::set<int> parseDayList(const std::string& spec);
+
+// Parses a year such as "2020". Throws std::invalid_argument if it isn't a
+// number or is from before the first Advent of Code.
+int parseYear(const std::string& text);
+
+// Parses the value of a numeric option such as "--runs 5". Throws
+// std::invalid_argument naming the option if it isn't a whole number of at
+// least 'min'.
+uint64_t parseCount(const std::string& option, const std::string& text, uint64_t min = 0);
+
+}
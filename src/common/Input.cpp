@@ -0,0 +1,180 @@
+#include "Input.h"
+
+#include <cstdio>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace aoc {
+
+namespace {
+
+std::string readAll(std::FILE* file)
+{
+    std::string buffer;
+    char chunk[64 * 1024];
+    size_t count;
+    while ((count = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        buffer.append(chunk, count);
+    }
+
+    return buffer;
+}
+
+}
+
+Input Input::open(const std::string& path)
+{
+    if (path == "-") {
+        return fromStdin();
+    }
+
+    Input input;
+
+#ifdef _WIN32
+    auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Unable to open " + path);
+    }
+
+    LARGE_INTEGER size;
+    if (GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &size)) {
+        if (size.QuadPart == 0) {
+            CloseHandle(file);
+            return input;
+        }
+
+        // The view keeps the mapping alive, so both handles can be closed right away.
+        auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            input.m_mapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+
+        if (input.m_mapping != nullptr) {
+            CloseHandle(file);
+            input.m_data = static_cast<const char*>(input.m_mapping);
+            input.m_size = static_cast<size_t>(size.QuadPart);
+            return input;
+        }
+    }
+    CloseHandle(file);
+
+    // Not something we can map, read it the slow way.
+    auto stream = std::fopen(path.c_str(), "rb");
+    if (stream == nullptr) {
+        throw std::runtime_error("Unable to open " + path);
+    }
+    input.m_buffer = readAll(stream);
+    std::fclose(stream);
+#else
+    auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Unable to open " + path);
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+        if (info.st_size == 0) {
+            close(fd);
+            return input;
+        }
+
+        auto mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            close(fd);
+            madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+            input.m_mapping = mapping;
+            input.m_data = static_cast<const char*>(mapping);
+            input.m_size = static_cast<size_t>(info.st_size);
+            return input;
+        }
+    }
+
+    // Pipes, FIFOs and devices can't be mapped, read them the slow way.
+    auto stream = fdopen(fd, "rb");
+    if (stream == nullptr) {
+        close(fd);
+        throw std::runtime_error("Unable to read " + path);
+    }
+    input.m_buffer = readAll(stream);
+    std::fclose(stream);
+#endif
+
+    input.m_data = input.m_buffer.data();
+    input.m_size = input.m_buffer.size();
+    return input;
+}
+
+Input Input::fromStdin()
+{
+    return fromString(readAll(stdin));
+}
+
+Input Input::fromString(std::string data)
+{
+    Input input;
+    input.m_buffer = std::move(data);
+    input.m_data = input.m_buffer.data();
+    input.m_size = input.m_buffer.size();
+    return input;
+}
+
+Input::Input(Input&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+Input& Input::operator=(Input&& other) noexcept
+{
+    if (this == &other) {
+        return *this;
+    }
+
+    release();
+    m_mapping = std::exchange(other.m_mapping, nullptr);
+    m_buffer = std::move(other.m_buffer);
+    m_size = std::exchange(other.m_size, 0);
+    m_data = std::exchange(other.m_data, nullptr);
+
+    // Moving a short string copies it, so point back at our own buffer.
+    if (m_mapping == nullptr) {
+        m_data = m_buffer.data();
+    }
+
+    return *this;
+}
+
+Input::~Input()
+{
+    release();
+}
+
+void Input::release()
+{
+    if (m_mapping != nullptr) {
+#ifdef _WIN32
+        UnmapViewOfFile(m_mapping);
+#else
+        munmap(m_mapping, m_size);
+#endif
+        m_mapping = nullptr;
+    }
+
+    m_buffer.clear();
+    m_data = nullptr;
+    m_size = 0;
+}
+
+}
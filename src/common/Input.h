@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace aoc {
+
+/**
+ * Walks a text buffer one line (or one blank-line separated record) at a
+ * time, handing out string_views into the buffer. Nothing is copied.
+ *
+ * Lines follow std::getline semantics: the final newline does not produce
+ * an extra empty line, and a trailing '\r' is dropped so CRLF inputs work.
+ *
+ * Records are runs of non-blank lines. The view spans from the start of the
+ * first line to the end of the last one, so it still contains the newlines
+ * in between.
+ **/
+class LineIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view*;
+    using reference = const std::string_view&;
+
+    // Default constructed iterator is the end iterator.
+    LineIterator() = default;
+
+    LineIterator(std::string_view buffer, bool records)
+        : m_next(buffer.data())
+        , m_end(buffer.data() + buffer.size())
+        , m_records(records)
+    {
+        advance();
+    }
+
+    reference operator*() const { return m_current; }
+    pointer operator->() const { return &m_current; }
+
+    LineIterator& operator++()
+    {
+        advance();
+        return *this;
+    }
+
+    LineIterator operator++(int)
+    {
+        auto copy = *this;
+        advance();
+        return copy;
+    }
+
+    bool operator==(const LineIterator& other) const { return m_current.data() == other.m_current.data(); }
+    bool operator!=(const LineIterator& other) const { return !(*this == other); }
+
+private:
+    // Pulls the next line off the buffer, returns false when there is none.
+    bool nextLine(std::string_view& line)
+    {
+        if (m_next == nullptr || m_next == m_end) {
+            return false;
+        }
+
+        auto newline = static_cast<const char*>(std::memchr(m_next, '\n', m_end - m_next));
+        auto lineEnd = newline ? newline : m_end;
+        line = std::string_view(m_next, lineEnd - m_next);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+
+        m_next = newline ? newline + 1 : m_end;
+        return true;
+    }
+
+    void advance()
+    {
+        std::string_view line;
+        if (!m_records) {
+            m_current = nextLine(line) ? line : std::string_view();
+            return;
+        }
+
+        // Skip blank lines before the record.
+        do {
+            if (!nextLine(line)) {
+                m_current = std::string_view();
+                return;
+            }
+        } while (line.empty());
+
+        // Extend the record until the next blank line.
+        auto recordStart = line.data();
+        auto recordEnd = line.data() + line.size();
+        while (nextLine(line) && !line.empty()) {
+            recordEnd = line.data() + line.size();
+        }
+
+        m_current = std::string_view(recordStart, recordEnd - recordStart);
+    }
+
+    const char* m_next = nullptr;
+    const char* m_end = nullptr;
+    bool m_records = false;
+    std::string_view m_current;
+};
+
+class LineRange
+{
+public:
+    LineRange(std::string_view buffer, bool records)
+        : m_buffer(buffer)
+        , m_records(records)
+    {}
+
+    LineIterator begin() const { return LineIterator(m_buffer, m_records); }
+    LineIterator end() const { return LineIterator(); }
+
+private:
+    std::string_view m_buffer;
+    bool m_records;
+};
+
+/**
+ * Puzzle input loaded into a single contiguous buffer.
+ *
+ * Regular files are memory mapped read-only, so loading costs page faults
+ * rather than one allocation per line. Pipes, terminals and stdin ("-") fall
+ * back to reading everything into an owned buffer.
+ *
+ * Views handed out by data(), lines() and records() are valid for as long as
+ * the Input is alive.
+ **/
+class Input
+{
+public:
+    // Opens path, or stdin if the path is "-".
+    static Input open(const std::string& path);
+    static Input fromStdin();
+    static Input fromString(std::string data);
+
+    Input(Input&& other) noexcept;
+    Input& operator=(Input&& other) noexcept;
+    Input(const Input&) = delete;
+    Input& operator=(const Input&) = delete;
+    ~Input();
+
+    std::string_view data() const { return std::string_view(m_data, m_size); }
+    size_t size() const { return m_size; }
+    bool isMapped() const { return m_mapping != nullptr; }
+
+    LineRange lines() const { return LineRange(data(), false); }
+    LineRange records() const { return LineRange(data(), true); }
+
+private:
+    Input() = default;
+    void release();
+
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+
+    // Start of the mapped view, null when the data lives in m_buffer.
+    void* m_mapping = nullptr;
+
+    // Owned storage for inputs that could not be mapped.
+    std::string m_buffer;
+};
+
+}
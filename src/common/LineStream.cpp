@@ -0,0 +1,123 @@
+#include "LineStream.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#define AOC_OPEN(path) _open(path, _O_RDONLY | _O_BINARY)
+#define AOC_READ(fd, buffer, count) _read(fd, buffer, static_cast<unsigned>(count))
+#define AOC_CLOSE(fd) _close(fd)
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#define AOC_OPEN(path) ::open(path, O_RDONLY)
+#define AOC_READ(fd, buffer, count) ::read(fd, buffer, count)
+#define AOC_CLOSE(fd) ::close(fd)
+#endif
+
+namespace aoc {
+
+LineStream::LineStream(const std::string& path, size_t blockSize)
+    : m_fd(path == "-" ? 0 : AOC_OPEN(path.c_str()))
+    , m_ownsFd(path != "-")
+    , m_buffer(blockSize)
+{
+    if (m_fd < 0) {
+        throw std::runtime_error("Unable to open " + path);
+    }
+}
+
+LineStream::~LineStream()
+{
+    if (m_ownsFd) {
+        AOC_CLOSE(m_fd);
+    }
+}
+
+bool LineStream::next(std::string_view& line)
+{
+    size_t searched = 0;
+    while (true) {
+        auto start = m_buffer.data() + m_begin;
+        auto newline = static_cast<const char*>(std::memchr(start + searched, '\n', m_end - m_begin - searched));
+        if (newline != nullptr) {
+            line = std::string_view(start, newline - start);
+            m_begin += line.size() + 1;
+            break;
+        }
+
+        searched = m_end - m_begin;
+        if (!fill()) {
+            // Last line without a trailing newline.
+            if (m_begin == m_end) {
+                return false;
+            }
+            line = std::string_view(m_buffer.data() + m_begin, m_end - m_begin);
+            m_begin = m_end;
+            break;
+        }
+    }
+
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+
+    return true;
+}
+
+bool LineStream::nextBlock(std::string_view& block)
+{
+    // Anything next() left buffered goes first, after that the buffer never grows.
+    if (m_begin == m_end) {
+        m_begin = 0;
+        m_end = 0;
+        if (!fill()) {
+            return false;
+        }
+    }
+
+    block = std::string_view(m_buffer.data() + m_begin, m_end - m_begin);
+    m_begin = m_end;
+    return true;
+}
+
+bool LineStream::fill()
+{
+    if (m_eof) {
+        return false;
+    }
+
+    // Move the partial line to the front, only growing if a single line fills the block.
+    if (m_begin > 0) {
+        std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+        m_end -= m_begin;
+        m_begin = 0;
+    }
+    if (m_end == m_buffer.size()) {
+        m_buffer.resize(m_buffer.size() * 2);
+    }
+
+    // read() returns as soon as anything is available, so a live pipe isn't held up.
+    // A signal arriving mid-read isn't an error, anything else that fails
+    // must not pass for the end of the input.
+    auto count = AOC_READ(m_fd, m_buffer.data() + m_end, m_buffer.size() - m_end);
+    while (count < 0 && errno == EINTR) {
+        count = AOC_READ(m_fd, m_buffer.data() + m_end, m_buffer.size() - m_end);
+    }
+    if (count < 0) {
+        throw std::runtime_error(std::string("Unable to read input: ") + std::strerror(errno));
+    }
+    if (count == 0) {
+        m_eof = true;
+        return false;
+    }
+
+    m_end += static_cast<size_t>(count);
+    return true;
+}
+
+}
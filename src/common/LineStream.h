@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aoc {
+
+/**
+ * Reads lines from a file or pipe as they arrive, a block at a time.
+ *
+ * Unlike Input this never holds more than one block (plus the line that
+ * straddles it) in memory, and returns each line as soon as its newline has
+ * been read rather than waiting for a full buffer, so it works on unbounded
+ * or live streams. Lines follow the same rules as Input::lines().
+ **/
+class LineStream
+{
+public:
+    // Reads path, or stdin if the path is "-".
+    explicit LineStream(const std::string& path, size_t blockSize = 4096);
+    LineStream(const LineStream&) = delete;
+    LineStream& operator=(const LineStream&) = delete;
+    ~LineStream();
+
+    // Gets the next line, false once the stream is exhausted. The view is
+    // only valid until the next call. Throws std::runtime_error if reading
+    // fails, so an error never looks like the end of the input.
+    bool next(std::string_view& line);
+
+    // Gets whatever the next read returns, at most a block, with no regard
+    // for lines. For callers that can pick up a line where the last block
+    // cut it off. The view is only valid until the next call.
+    bool nextBlock(std::string_view& block);
+
+    // Bytes currently buffered, for keeping an eye on memory use.
+    size_t capacity() const { return m_buffer.size(); }
+
+private:
+    // Reads whatever is available into the buffer, returns false at end of
+    // stream. Retries reads interrupted by a signal.
+    bool fill();
+
+    int m_fd;
+    bool m_ownsFd;
+    bool m_eof = false;
+    std::vector<char> m_buffer;
+    size_t m_begin = 0;
+    size_t m_end = 0;
+};
+
+}
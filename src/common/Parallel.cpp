@@ -0,0 +1,68 @@
+#include "Parallel.h"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+namespace aoc {
+
+size_t hardwareThreads()
+{
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void parallelFor(size_t count, const std::function<void(size_t)>& body)
+{
+    std::vector<std::exception_ptr> errors(count);
+    auto run = [&](size_t idx) {
+        try {
+            body(idx);
+        } catch (...) {
+            errors[idx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t idx = 1; idx < count; ++idx) {
+        threads.emplace_back(run, idx);
+    }
+    if (count > 0) {
+        run(0);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+std::vector<std::string_view> splitAtNewlines(std::string_view buffer, size_t parts)
+{
+    std::vector<std::string_view> pieces;
+    parts = std::max<size_t>(parts, 1);
+
+    size_t start = 0;
+    for (size_t part = 1; part < parts && start < buffer.size(); ++part) {
+        // Aim for an even split of what's left, then move up to the next line.
+        auto target = std::max(start, buffer.size() * part / parts);
+        auto newline = buffer.find('\n', target);
+        if (newline == std::string_view::npos) {
+            break;
+        }
+
+        pieces.push_back(buffer.substr(start, newline + 1 - start));
+        start = newline + 1;
+    }
+
+    if (start < buffer.size() || pieces.empty()) {
+        pieces.push_back(buffer.substr(start));
+    }
+
+    return pieces;
+}
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace aoc {
+
+/**
+ * Helpers for splitting one pass over the input across threads.
+ *
+ * Threads are started per call and joined before it returns, which is cheap
+ * next to the multi-megabyte passes they're used for.
+ **/
+
+// Number of hardware threads, at least 1.
+size_t hardwareThreads();
+
+// Runs body(0) to body(count - 1), each on its own thread. The calling
+// thread takes body(0). The first exception thrown by a body is rethrown
+// once all of them have finished.
+void parallelFor(size_t count, const std::function<void(size_t)>& body);
+
+// Cuts buffer into at most 'parts' pieces of roughly equal size. Every
+// piece but the last ends just after a newline, so no line is split, and
+// the pieces cover the buffer exactly.
+std::vector<std::string_view> splitAtNewlines(std::string_view buffer, size_t parts);
+
+}
@@ -0,0 +1,201 @@
+#include "ParseCache.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace aoc {
+
+namespace {
+
+constexpr char fileMagic[8] = { 'A', 'O', 'C', 'P', 'A', 'R', 'S', 'E' };
+
+// Bumped whenever the header or section table change.
+constexpr uint32_t formatVersion = 1;
+
+// Reads back as something else on a machine with the other byte order.
+constexpr uint32_t byteOrderMark = 0x01020304;
+
+constexpr size_t sectionAlignment = 64;
+
+struct FileHeader
+{
+    char magic[8];
+    uint32_t byteOrder;
+    uint32_t format;
+    uint32_t year;
+    uint32_t day;
+    uint32_t version;
+    uint32_t sectionCount;
+    uint64_t inputHash;
+    uint64_t inputSize;
+};
+
+// Followed by one of these per section.
+struct SectionEntry
+{
+    uint64_t offset;
+    uint64_t size;
+};
+
+size_t alignUp(size_t offset)
+{
+    return (offset + sectionAlignment - 1) / sectionAlignment * sectionAlignment;
+}
+
+uint64_t mix(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCD;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53;
+    return hash ^ (hash >> 33);
+}
+
+}
+
+uint64_t contentHash(std::string_view data)
+{
+    // A multiply and a shift per 8 bytes, a small fraction of what parsing
+    // the same bytes costs.
+    uint64_t hash = 0x9E3779B97F4A7C15 ^ data.size();
+    size_t pos = 0;
+    for (; pos + 8 <= data.size(); pos += 8) {
+        uint64_t word;
+        std::memcpy(&word, data.data() + pos, sizeof(word));
+        hash = (hash ^ word) * 0x9E3779B97F4A7C15;
+        hash ^= hash >> 29;
+    }
+
+    // memcpy needs a valid pointer even for no bytes, and empty views may not have one.
+    uint64_t tail = 0;
+    if (pos < data.size()) {
+        std::memcpy(&tail, data.data() + pos, data.size() - pos);
+    }
+    hash = (hash ^ tail) * 0x9E3779B97F4A7C15;
+    return mix(hash);
+}
+
+ParseCacheKey ParseCacheKey::of(int year, int day, uint32_t version, std::string_view input)
+{
+    return { year, day, version, contentHash(input), input.size() };
+}
+
+std::string ParseCacheKey::fileName() const
+{
+    char name[64];
+    std::snprintf(name, sizeof(name), "%d_%02d_%016llx.bin", year, day, static_cast<unsigned long long>(inputHash));
+    return name;
+}
+
+void ParseCacheWriter::addBytes(const void* data, size_t size)
+{
+    m_sections.emplace_back(static_cast<const char*>(data), size);
+}
+
+void ParseCacheWriter::write(const std::string& path, const ParseCacheKey& key) const
+{
+    FileHeader header = {};
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.byteOrder = byteOrderMark;
+    header.format = formatVersion;
+    header.year = static_cast<uint32_t>(key.year);
+    header.day = static_cast<uint32_t>(key.day);
+    header.version = key.version;
+    header.sectionCount = static_cast<uint32_t>(m_sections.size());
+    header.inputHash = key.inputHash;
+    header.inputSize = key.inputSize;
+
+    std::vector<SectionEntry> entries;
+    auto offset = alignUp(sizeof(FileHeader) + m_sections.size() * sizeof(SectionEntry));
+    for (const auto& section : m_sections) {
+        entries.push_back({ offset, section.size() });
+        offset = alignUp(offset + section.size());
+    }
+
+    std::string file(offset, '\0');
+    std::memcpy(file.data(), &header, sizeof(header));
+    if (!entries.empty()) {
+        std::memcpy(file.data() + sizeof(header), entries.data(), entries.size() * sizeof(SectionEntry));
+    }
+    for (size_t idx = 0; idx < m_sections.size(); ++idx) {
+        std::memcpy(file.data() + entries[idx].offset, m_sections[idx].data(), m_sections[idx].size());
+    }
+
+    auto temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out.write(file.data(), static_cast<std::streamsize>(file.size()));
+        if (!out) {
+            throw std::runtime_error("Unable to write " + temporary);
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        std::filesystem::remove(temporary, error);
+        throw std::runtime_error("Unable to write " + path);
+    }
+}
+
+std::unique_ptr<ParseCache> ParseCache::open(const std::string& path, const ParseCacheKey& key)
+{
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error)) {
+        return nullptr;
+    }
+
+    std::unique_ptr<ParseCache> cache(new ParseCache(Input::open(path)));
+    auto data = cache->m_file.data();
+    if (data.size() < sizeof(FileHeader)) {
+        return nullptr;
+    }
+
+    FileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    auto matches = std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) == 0
+        && header.byteOrder == byteOrderMark
+        && header.format == formatVersion
+        && header.year == static_cast<uint32_t>(key.year)
+        && header.day == static_cast<uint32_t>(key.day)
+        && header.version == key.version
+        && header.inputHash == key.inputHash
+        && header.inputSize == key.inputSize;
+    if (!matches || (data.size() - sizeof(FileHeader)) / sizeof(SectionEntry) < header.sectionCount) {
+        return nullptr;
+    }
+
+    for (size_t idx = 0; idx < header.sectionCount; ++idx) {
+        SectionEntry entry;
+        std::memcpy(&entry, data.data() + sizeof(FileHeader) + idx * sizeof(SectionEntry), sizeof(entry));
+        if (entry.offset % sectionAlignment != 0 || entry.offset > data.size() || entry.size > data.size() - entry.offset) {
+            return nullptr;
+        }
+
+        // Offsets are aligned within the file, which only makes the bytes
+        // aligned if the file itself is. A mapping always is, a buffer the
+        // file had to be read into might not be.
+        auto address = reinterpret_cast<uintptr_t>(data.data() + entry.offset);
+        if (address % alignof(std::max_align_t) != 0) {
+            return nullptr;
+        }
+        cache->m_sections.push_back(data.substr(entry.offset, entry.size));
+    }
+
+    return cache;
+}
+
+std::string_view ParseCache::sectionBytes(size_t idx) const
+{
+    if (idx >= m_sections.size()) {
+        throw std::runtime_error(
+            "Cache has " + std::to_string(m_sections.size()) + " sections, no section " + std::to_string(idx));
+    }
+    return m_sections[idx];
+}
+
+}
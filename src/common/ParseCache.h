@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "Input.h"
+
+namespace aoc {
+
+/**
+ * Parsed input saved to disk, so repeat runs over the same input map it
+ * back in instead of parsing the text again.
+ *
+ * A cache file is a header, a table of sections and the sections
+ * themselves, each starting on a 64 byte boundary so it can be used in
+ * place as an array of any trivially copyable type once mapped. open()
+ * checks that the bytes really are aligned for any such type in memory,
+ * and treats the file as a miss if not. The file name and the header both
+ * carry the day and a hash of the input's content, and the header also has
+ * the container and day layout versions, so an edited input or a changed
+ * layout is a miss rather than garbage.
+ * Numbers are stored in native byte order, files from a machine with the
+ * other one are a miss as well.
+ **/
+
+// 64-bit hash of the whole input, word at a time.
+uint64_t contentHash(std::string_view data);
+
+// What a cache file has to match to be used.
+struct ParseCacheKey
+{
+    int year = 0;
+    int day = 0;
+
+    // The day's own layout version, see Solution::cacheVersion().
+    uint32_t version = 0;
+
+    uint64_t inputHash = 0;
+    uint64_t inputSize = 0;
+
+    static ParseCacheKey of(int year, int day, uint32_t version, std::string_view input);
+
+    // "<year>_<day>_<hash>.bin", unique per day and input.
+    std::string fileName() const;
+};
+
+class ParseCacheWriter
+{
+public:
+    template<typename T>
+    void add(std::span<const T> values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Sections are mapped back in as they were written");
+        addBytes(values.data(), values.size_bytes());
+    }
+
+    template<typename T>
+    void add(const std::vector<T>& values)
+    {
+        add(std::span<const T>(values));
+    }
+
+    void addBytes(const void* data, size_t size);
+
+    // Writes to a temporary file and renames it into place, so a reader
+    // never sees half a file. Throws std::runtime_error if it can't.
+    void write(const std::string& path, const ParseCacheKey& key) const;
+
+private:
+    std::vector<std::string> m_sections;
+};
+
+class ParseCache
+{
+public:
+    // Maps the file in, null if it's missing, damaged or doesn't match the
+    // key, any of which just means parsing the text again.
+    static std::unique_ptr<ParseCache> open(const std::string& path, const ParseCacheKey& key);
+
+    size_t sections() const { return m_sections.size(); }
+
+    // Section 'idx' in place, aligned to at least alignof(std::max_align_t).
+    // Throws std::runtime_error if there's no such section or its size isn't
+    // a whole number of T.
+    template<typename T>
+    std::span<const T> section(size_t idx) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Sections are mapped back in as they were written");
+        auto bytes = sectionBytes(idx);
+        if (bytes.size() % sizeof(T) != 0) {
+            throw std::runtime_error("Cache section " + std::to_string(idx) + " doesn't hold whole elements");
+        }
+        return std::span<const T>(reinterpret_cast<const T*>(bytes.data()), bytes.size() / sizeof(T));
+    }
+
+private:
+    explicit ParseCache(Input file)
+        : m_file(std::move(file))
+    {}
+
+    std::string_view sectionBytes(size_t idx) const;
+
+    Input m_file;
+    std::vector<std::string_view> m_sections;
+};
+
+}
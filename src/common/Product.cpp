@@ -0,0 +1,69 @@
+#include "Product.h"
+
+#include <limits>
+
+namespace aoc {
+
+bool checkedMultiply(uint64_t a, uint64_t b, uint64_t& product)
+{
+    if (a != 0 && b > std::numeric_limits<uint64_t>::max() / a) {
+        return false;
+    }
+
+    product = a * b;
+    return true;
+}
+
+std::string exactProduct(const std::vector<uint64_t>& factors)
+{
+    uint64_t small = 1;
+    size_t next = 0;
+    for (; next < factors.size() && checkedMultiply(small, factors[next], small); ++next) {
+    }
+    if (next == factors.size()) {
+        return std::to_string(small);
+    }
+
+    // Little endian base 10^9 limbs.
+    constexpr uint64_t base = 1000000000;
+    std::vector<uint64_t> limbs = { small % base, (small / base) % base, small / base / base };
+    for (; next < factors.size(); ++next) {
+        auto factor = factors[next];
+
+        // Split the factor into limbs too so limb * part + carry stays within 64 bits.
+        std::vector<uint64_t> result(limbs.size() + 3, 0);
+        uint64_t parts[] = { factor % base, (factor / base) % base, factor / base / base };
+        for (size_t p = 0; p < 3; ++p) {
+            uint64_t carry = 0;
+            for (size_t idx = 0; idx < limbs.size(); ++idx) {
+                auto value = result[idx + p] + limbs[idx] * parts[p] + carry;
+                result[idx + p] = value % base;
+                carry = value / base;
+            }
+            for (auto idx = limbs.size() + p; carry != 0; ++idx) {
+                auto value = result[idx] + carry;
+                result[idx] = value % base;
+                carry = value / base;
+            }
+        }
+
+        while (result.size() > 1 && result.back() == 0) {
+            result.pop_back();
+        }
+        limbs = std::move(result);
+    }
+
+    while (limbs.size() > 1 && limbs.back() == 0) {
+        limbs.pop_back();
+    }
+
+    auto text = std::to_string(limbs.back());
+    for (auto idx = limbs.size() - 1; idx-- > 0;) {
+        auto limb = std::to_string(limbs[idx]);
+        text += std::string(9 - limb.size(), '0') + limb;
+    }
+
+    return text;
+}
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aoc {
+
+// Multiplies a and b into product, returns false instead if it would overflow.
+bool checkedMultiply(uint64_t a, uint64_t b, uint64_t& product);
+
+// The exact product of all the factors in decimal, however many digits it
+// takes. Stays in 64-bit arithmetic until the product stops fitting.
+std::string exactProduct(const std::vector<uint64_t>& factors);
+
+}
@@ -0,0 +1,98 @@
+#include "Simd.h"
+
+#if AOC_X86_64 && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace aoc {
+
+#if AOC_X86_64 && defined(_MSC_VER) && !defined(__clang__)
+
+namespace {
+
+struct CpuFeatures
+{
+    bool avx2 = false;
+    bool avx512 = false;
+
+    CpuFeatures()
+    {
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return;
+        }
+
+        __cpuid(info, 1);
+        auto osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+        auto osSavesZmm = osSavesYmm && (_xgetbv(0) & 0xE0) == 0xE0;
+
+        __cpuidex(info, 7, 0);
+        avx2 = osSavesYmm && (info[1] & (1 << 5));
+        avx512 = osSavesZmm && (info[1] & (1 << 16)) && (info[1] & (1 << 30)) && (info[1] & (1u << 31));
+    }
+};
+
+const CpuFeatures& features()
+{
+    static const CpuFeatures cpu;
+    return cpu;
+}
+
+}
+
+bool cpuHasAvx2() { return features().avx2; }
+bool cpuHasAvx512() { return features().avx512; }
+
+#elif AOC_X86_64
+
+bool cpuHasAvx2() { return __builtin_cpu_supports("avx2"); }
+bool cpuHasAvx512()
+{
+    return __builtin_cpu_supports("avx512f")
+        && __builtin_cpu_supports("avx512bw")
+        && __builtin_cpu_supports("avx512vl");
+}
+
+#else
+
+bool cpuHasAvx2() { return false; }
+bool cpuHasAvx512() { return false; }
+
+#endif
+
+bool tryParseSimdLevel(std::string_view name, SimdLevel& level)
+{
+    if (name == "auto") {
+        level = SimdLevel::Auto;
+    } else if (name == "scalar") {
+        level = SimdLevel::Scalar;
+    } else if (name == "avx2") {
+        level = SimdLevel::Avx2;
+    } else if (name == "avx512") {
+        level = SimdLevel::Avx512;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool resolveSimdLevel(SimdLevel& level)
+{
+    switch (level) {
+    case SimdLevel::Auto:
+        level = cpuHasAvx512() ? SimdLevel::Avx512
+            : cpuHasAvx2() ? SimdLevel::Avx2
+            : SimdLevel::Scalar;
+        return true;
+    case SimdLevel::Avx2:
+        return cpuHasAvx2();
+    case SimdLevel::Avx512:
+        return cpuHasAvx512();
+    default:
+        return true;
+    }
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+/**
+ * Helpers for kernels with hand written SIMD paths.
+ *
+ * Kernels are compiled per function with AOC_TARGET so the rest of the build
+ * stays baseline x86-64, and picked at runtime with the cpuHas*() checks.
+ * MSVC doesn't need (or support) per-function targets, the intrinsics are
+ * always available there.
+ **/
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AOC_X86_64 1
+#include <immintrin.h>
+#else
+#define AOC_X86_64 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AOC_TARGET(isa) __attribute__((target(isa)))
+#else
+#define AOC_TARGET(isa)
+#endif
+
+#include <string_view>
+
+namespace aoc {
+
+// Which kernel family to run, as picked by a "kernel=" option.
+enum class SimdLevel
+{
+    Auto,
+    Scalar,
+    Avx2,
+    Avx512,
+};
+
+bool tryParseSimdLevel(std::string_view name, SimdLevel& level);
+
+// Turns Auto into the widest level this CPU supports. Returns false if the
+// requested level isn't supported.
+bool resolveSimdLevel(SimdLevel& level);
+
+bool cpuHasAvx2();
+
+// AVX-512 F, BW and VL, so dword and byte lanes are usable at every width.
+bool cpuHasAvx512();
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "Input.h"
+#include "ParseCache.h"
+
+namespace aoc {
+
+/**
+ * A single day's puzzle, split into the phases the runner times separately.
+ *
+ * parse() may be called any number of times and must throw away whatever a
+ * previous call left behind. part1() and part2() are always called in order
+ * after parse(), so part2() may reuse work done by part1().
+ * The input outlives everything parse() produces, so it's fine to keep
+ * views into it rather than copies.
+ *
+ * setOption() is called before the first parse() for every "--set key=value"
+ * given to the runner. Return false for keys the day doesn't know about.
+ *
+ * Days whose parsed form is worth keeping between runs return a non-zero
+ * cacheVersion(). With a cache directory, the runner then saves what
+ * parse() built with saveParsed() and on later runs over the same input
+ * calls loadParsed() instead of parse(). The cache, like the input,
+ * outlives everything loadParsed() produces, so sections can be used in
+ * place.
+ **/
+class Solution
+{
+public:
+    virtual ~Solution() = default;
+
+    virtual void parse(const Input& input) = 0;
+    virtual std::string part1() = 0;
+    virtual std::string part2() = 0;
+
+    virtual bool setOption(std::string_view /*key*/, std::string_view /*value*/) { return false; }
+
+    // Layout version of the saved form, bumped whenever saveParsed()
+    // changes, 0 if there's none. May depend on the options.
+    virtual uint32_t cacheVersion() const { return 0; }
+    virtual void saveParsed(ParseCacheWriter& /*cache*/) const {}
+    virtual void loadParsed(const ParseCache& /*cache*/, const Input& /*input*/) {}
+};
+
+struct Day
+{
+    int year;
+    int day;
+    const char* title;
+    std::unique_ptr<Solution> (*create)();
+};
+
+}
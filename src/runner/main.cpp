@@ -0,0 +1,418 @@
+/**
+ * Runs any subset of the solved days in a single process.
+ *
+ *   aoc                     every day of every year
+ *   aoc 2020                every day of 2020
+ *   aoc 2020 1-3,5          days 1, 2, 3 and 5 of 2020
+ *
+ * Options:
+ *   --inputs <dir>          read <dir>/<year>/<day>/input.txt (default: source tree)
+ *   --input <file>          read this file instead, only valid with a single day ('-' is stdin)
+ *   --runs <n>              timed iterations of every phase (default: 10)
+ *   --warmup <n>            untimed iterations before those (default: 2)
+ *   --format <fmt>          table, json or csv (default: table)
+ *   --set <key>=<value>     day specific option, may be repeated
+ *   --cache <dir>           keep parsed input in <dir> and map it back in on
+ *                           later runs over the same input, for the days
+ *                           that support it. Those days report a "Cached"
+ *                           phase, the cost of mapping it in, instead of
+ *                           "Parse"
+ **/
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.h"
+#include "DayList.h"
+#include "Input.h"
+#include "ParseCache.h"
+#include "Solution.h"
+#include "Year2020.h"
+
+namespace {
+
+struct Result
+{
+    const aoc::Day* day = nullptr;
+    std::string part1;
+    std::string part2;
+
+    // Stats for each phase, the last entry is the total.
+    std::vector<std::string> phases;
+    std::vector<aoc::Stats> stats;
+
+    // Which of the --set options the day understood.
+    std::vector<bool> acceptedSettings;
+};
+
+void printUsage(std::ostream& out)
+{
+    out
+        << "Usage: aoc [year [days]] [options]" << std::endl
+        << std::endl
+        << "  days                    such as 1-3,5, every day of the year if left out" << std::endl
+        << "  --inputs <dir>          read <dir>/<year>/<day>/input.txt" << std::endl
+        << "  --input <file>          read this file instead, only valid with a single day ('-' is stdin)" << std::endl
+        << "  --runs <n>              timed iterations of every phase (default: 10)" << std::endl
+        << "  --warmup <n>            untimed iterations before those (default: 2)" << std::endl
+        << "  --format <fmt>          table, json or csv (default: table)" << std::endl
+        << "  --set <key>=<value>     day specific option, may be repeated" << std::endl
+        << "  --cache <dir>           keep parsed input in <dir> for later runs" << std::endl;
+}
+
+// A whole non-negative number, false otherwise.
+bool parseCount(std::string_view text, int& count)
+{
+    auto end = text.data() + text.size();
+    auto result = std::from_chars(text.data(), end, count);
+    return !text.empty() && result.ec == std::errc() && result.ptr == end && count >= 0;
+}
+
+std::string inputPath(const std::string& root, const aoc::Day& day)
+{
+    char relative[32];
+    std::snprintf(relative, sizeof(relative), "/%d/%02d/input.txt", day.year, day.day);
+    return root + relative;
+}
+
+using Settings = std::vector<std::pair<std::string, std::string>>;
+
+// Makes sure the cache holds the parsed form of this input, parsing the
+// text and saving it if it doesn't. Runs once before the timed loop, so
+// the "Cached" phase only ever times loading the cache.
+void primeCache(aoc::Solution& solution, const aoc::Day& day, const aoc::Input& input, const std::string& cacheDir)
+{
+    auto key = aoc::ParseCacheKey::of(day.year, day.day, solution.cacheVersion(), input.data());
+    auto path = cacheDir + "/" + key.fileName();
+    if (aoc::ParseCache::open(path, key) == nullptr) {
+        solution.parse(input);
+        aoc::ParseCacheWriter writer;
+        solution.saveParsed(writer);
+        writer.write(path, key);
+    }
+}
+
+// Maps the parsed input in from the cache primed above. 'cache' keeps the
+// mapping alive for as long as the solution uses it.
+void loadCached(
+    aoc::Solution& solution, const aoc::Day& day, const aoc::Input& input, const std::string& cacheDir,
+    std::unique_ptr<aoc::ParseCache>& cache)
+{
+    auto key = aoc::ParseCacheKey::of(day.year, day.day, solution.cacheVersion(), input.data());
+    auto found = aoc::ParseCache::open(cacheDir + "/" + key.fileName(), key);
+    if (found == nullptr) {
+        throw std::runtime_error(
+            "Parse cache for " + std::to_string(day.year) + "/" + std::to_string(day.day) + " can't be opened");
+    }
+
+    solution.loadParsed(*found, input);
+    cache = std::move(found);
+}
+
+Result run(
+    const aoc::Day& day, const std::string& path, const Settings& settings, const std::string& cacheDir,
+    const aoc::Benchmark& benchmark)
+{
+    Result result;
+    result.day = &day;
+    auto solution = day.create();
+    for (const auto& [key, value] : settings) {
+        result.acceptedSettings.push_back(solution->setOption(key, value));
+    }
+
+    // Files are reloaded every iteration so the load is timed too, stdin can only be read once.
+    std::vector<aoc::Phase> phases;
+    auto input = aoc::Input::fromString(std::string());
+    if (path == "-") {
+        input = aoc::Input::fromStdin();
+    } else {
+        phases.push_back({ "Load", [&] { input = aoc::Input::open(path); } });
+    }
+
+    // With a cache the text is parsed at most once, up front, and what's
+    // timed is mapping the parsed form back in, under its own name.
+    auto cached = !cacheDir.empty() && solution->cacheVersion() != 0;
+    if (cached && path == "-") {
+        primeCache(*solution, day, input, cacheDir);
+    } else if (cached) {
+        primeCache(*solution, day, aoc::Input::open(path), cacheDir);
+    }
+
+    std::unique_ptr<aoc::ParseCache> cache;
+    if (cached) {
+        phases.push_back({ "Cached", [&] { loadCached(*solution, day, input, cacheDir, cache); } });
+    } else {
+        phases.push_back({ "Parse", [&] { solution->parse(input); } });
+    }
+    phases.push_back({ "Part1", [&] { result.part1 = solution->part1(); } });
+    phases.push_back({ "Part2", [&] { result.part2 = solution->part2(); } });
+
+    result.stats = benchmark.run(phases);
+    for (const auto& phase : phases) {
+        result.phases.push_back(phase.name);
+    }
+    result.phases.push_back("Total");
+
+    return result;
+}
+
+std::string dayName(const aoc::Day& day)
+{
+    return std::to_string(day.year) + "/" + std::to_string(day.day);
+}
+
+void printTable(const std::vector<Result>& results, int warmup, int runs)
+{
+    std::cout
+        << "steady_clock: resolution " << aoc::Benchmark::clockResolution() << "ns"
+        << ", overhead " << aoc::Benchmark::clockOverhead() << "ns"
+        << ", " << runs << " runs after " << warmup << " warmup" << std::endl << std::endl;
+
+    std::cout
+        << std::left << std::setw(10) << "Day"
+        << std::setw(22) << "Title"
+        << std::setw(16) << "Part1"
+        << "Part2" << std::endl;
+
+    for (const auto& result : results) {
+        std::cout
+            << std::left << std::setw(10) << dayName(*result.day)
+            << std::setw(22) << result.day->title
+            << std::setw(16) << result.part1
+            << result.part2 << std::endl;
+    }
+
+    std::cout
+        << std::endl
+        << std::left << std::setw(10) << "Day"
+        << std::setw(8) << "Phase"
+        << std::right << std::setw(14) << "Min"
+        << std::setw(14) << "Median"
+        << std::setw(14) << "P90"
+        << std::setw(14) << "P99"
+        << std::setw(14) << "Stddev" << "  (ns)" << std::endl;
+
+    for (const auto& result : results) {
+        for (size_t idx = 0; idx < result.stats.size(); ++idx) {
+            const auto& stats = result.stats[idx];
+            std::cout
+                << std::left << std::setw(10) << (idx == 0 ? dayName(*result.day) : "")
+                << std::setw(8) << result.phases[idx]
+                << std::right << std::setw(14) << stats.min
+                << std::setw(14) << stats.median
+                << std::setw(14) << stats.p90
+                << std::setw(14) << stats.p99
+                << std::setw(14) << std::fixed << std::setprecision(0) << stats.stddev << std::endl;
+        }
+    }
+}
+
+void printCsv(const std::vector<Result>& results)
+{
+    std::cout << "year,day,phase,runs,min_ns,median_ns,p90_ns,p99_ns,max_ns,mean_ns,stddev_ns" << std::endl;
+    for (const auto& result : results) {
+        for (size_t idx = 0; idx < result.stats.size(); ++idx) {
+            const auto& stats = result.stats[idx];
+            std::cout
+                << result.day->year << "," << result.day->day << "," << result.phases[idx] << ","
+                << stats.runs << "," << stats.min << "," << stats.median << ","
+                << stats.p90 << "," << stats.p99 << "," << stats.max << ","
+                << std::fixed << std::setprecision(1) << stats.mean << "," << stats.stddev << std::endl;
+        }
+    }
+}
+
+std::string jsonString(const std::string& value)
+{
+    std::string escaped = "\"";
+    for (auto c : value) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+
+    return escaped + "\"";
+}
+
+void printJson(const std::vector<Result>& results, int warmup, int runs)
+{
+    std::cout
+        << "{" << std::endl
+        << "  \"clock\": { \"resolution_ns\": " << aoc::Benchmark::clockResolution()
+        << ", \"overhead_ns\": " << aoc::Benchmark::clockOverhead() << " }," << std::endl
+        << "  \"warmup\": " << warmup << "," << std::endl
+        << "  \"runs\": " << runs << "," << std::endl
+        << "  \"days\": [" << std::endl;
+
+    for (size_t day = 0; day < results.size(); ++day) {
+        const auto& result = results[day];
+        std::cout
+            << "    {" << std::endl
+            << "      \"year\": " << result.day->year << "," << std::endl
+            << "      \"day\": " << result.day->day << "," << std::endl
+            << "      \"title\": " << jsonString(result.day->title) << "," << std::endl
+            << "      \"part1\": " << jsonString(result.part1) << "," << std::endl
+            << "      \"part2\": " << jsonString(result.part2) << "," << std::endl
+            << "      \"phases\": {" << std::endl;
+
+        for (size_t idx = 0; idx < result.stats.size(); ++idx) {
+            const auto& stats = result.stats[idx];
+            std::cout
+                << "        " << jsonString(result.phases[idx]) << ": {"
+                << " \"min_ns\": " << stats.min
+                << ", \"median_ns\": " << stats.median
+                << ", \"p90_ns\": " << stats.p90
+                << ", \"p99_ns\": " << stats.p99
+                << ", \"max_ns\": " << stats.max
+                << ", \"mean_ns\": " << std::fixed << std::setprecision(1) << stats.mean
+                << ", \"stddev_ns\": " << stats.stddev << " }"
+                << (idx + 1 < result.stats.size() ? "," : "") << std::endl;
+        }
+
+        std::cout
+            << "      }" << std::endl
+            << "    }" << (day + 1 < results.size() ? "," : "") << std::endl;
+    }
+
+    std::cout << "  ]" << std::endl << "}" << std::endl;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<aoc::Day> allDays(aoc::y2020::days());
+
+    std::string inputRoot = AOC_INPUT_ROOT;
+    std::string inputFile;
+    std::string format = "table";
+    std::string cacheDir;
+    auto runs = 10;
+    auto warmup = 2;
+    Settings settings;
+    std::vector<std::string> positional;
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg = argv[idx];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(std::cout);
+            return 0;
+        } else if (arg == "--inputs" && idx + 1 < argc) {
+            inputRoot = argv[++idx];
+        } else if (arg == "--input" && idx + 1 < argc) {
+            inputFile = argv[++idx];
+        } else if (arg == "--runs" && idx + 1 < argc) {
+            if (!parseCount(argv[++idx], runs)) {
+                std::cerr << "Bad --runs \"" << argv[idx] << "\"." << std::endl;
+                return 1;
+            }
+        } else if (arg == "--warmup" && idx + 1 < argc) {
+            if (!parseCount(argv[++idx], warmup)) {
+                std::cerr << "Bad --warmup \"" << argv[idx] << "\"." << std::endl;
+                return 1;
+            }
+        } else if (arg == "--format" && idx + 1 < argc) {
+            format = argv[++idx];
+        } else if (arg == "--cache" && idx + 1 < argc) {
+            cacheDir = argv[++idx];
+        } else if (arg == "--set" && idx + 1 < argc) {
+            std::string setting = argv[++idx];
+            auto equals = setting.find('=');
+            if (equals == std::string::npos) {
+                std::cerr << "Expected --set <key>=<value>." << std::endl;
+                return 1;
+            }
+            settings.emplace_back(setting.substr(0, equals), setting.substr(equals + 1));
+        } else if (arg.starts_with("-") || positional.size() == 2) {
+            // Unknown options, options missing their value and a third positional.
+            std::cerr << "Unexpected argument " << arg << "." << std::endl << std::endl;
+            printUsage(std::cerr);
+            return 1;
+        } else {
+            positional.push_back(std::move(arg));
+        }
+    }
+
+    auto year = 0;
+    std::set<int> dayList;
+    try {
+        year = positional.size() > 0 ? aoc::parseYear(positional[0]) : 0;
+        dayList = positional.size() > 1 ? aoc::parseDayList(positional[1]) : std::set<int>();
+    } catch (const std::invalid_argument& e) {
+        std::cerr << e.what() << "." << std::endl << std::endl;
+        printUsage(std::cerr);
+        return 1;
+    }
+
+    try {
+
+        std::vector<const aoc::Day*> selected;
+        for (const auto& day : allDays) {
+            if ((year == 0 || day.year == year) && (dayList.empty() || dayList.count(day.day))) {
+                selected.push_back(&day);
+            }
+        }
+
+        if (selected.empty()) {
+            std::cerr << "No matching days." << std::endl;
+            return 1;
+        }
+
+        if (!inputFile.empty() && selected.size() != 1) {
+            std::cerr << "--input can only be used with a single day." << std::endl;
+            return 1;
+        }
+
+        if (format != "table" && format != "json" && format != "csv") {
+            std::cerr << "Unknown format " << format << "." << std::endl;
+            return 1;
+        }
+
+        if (!cacheDir.empty()) {
+            std::filesystem::create_directories(cacheDir);
+        }
+
+        aoc::Benchmark benchmark(warmup, runs);
+        std::vector<Result> results;
+        for (auto day : selected) {
+            auto path = inputFile.empty() ? inputPath(inputRoot, *day) : inputFile;
+            results.push_back(run(*day, path, settings, cacheDir, benchmark));
+        }
+
+        // Options are shared by every selected day, but each one must be used by at least one of them.
+        for (size_t idx = 0; idx < settings.size(); ++idx) {
+            auto accepted = std::any_of(results.begin(), results.end(), [&](const Result& result) {
+                return result.acceptedSettings[idx];
+            });
+            if (!accepted) {
+                std::cerr << "Unknown option " << settings[idx].first << " for the selected days." << std::endl;
+                return 1;
+            }
+        }
+
+        if (format == "json") {
+            printJson(results, warmup, runs);
+        } else if (format == "csv") {
+            printCsv(results);
+        } else {
+            printTable(results, warmup, runs);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,1329 @@
+/**
+ * Cross-checks the fast paths against the plain implementations they
+ * replace, on generated inputs.
+ *
+ *   aoc_checks <check> [--seed <n>]
+ *
+ * Each check is registered as its own CTest test. Kernels the CPU doesn't
+ * support are skipped, the scalar ones always run. Mismatches are printed
+ * and make the check fail.
+ **/
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "BoardingPass.h"
+#include "Customs.h"
+#include "Entries.h"
+#include "Generators.h"
+#include "GridView.h"
+#include "Input.h"
+#include "KSum.h"
+#include "LineStream.h"
+#include "OnlineKSum.h"
+#include "ParseCache.h"
+#include "Passport.h"
+#include "PassportRules.h"
+#include "PassportScanner.h"
+#include "Passwords.h"
+#include "Search.h"
+#include "SeatIndex.h"
+#include "SeatMap.h"
+#include "Simd.h"
+#include "TrackedMap.h"
+#include "TreeMap.h"
+#include "Year2020.h"
+
+namespace {
+
+class Checker
+{
+public:
+    template<typename T>
+    void expect(const T& actual, const T& expected, const std::string& what)
+    {
+        if (!(actual == expected)) {
+            if (++m_failures <= 10) {
+                std::cerr << "Mismatch: " << what << ": got " << actual << ", expected " << expected << std::endl;
+            }
+        }
+    }
+
+    size_t failures() const { return m_failures; }
+
+private:
+    size_t m_failures = 0;
+};
+
+const aoc::Generator& generatorFor(int day)
+{
+    for (const auto& generator : aoc::generators()) {
+        if (generator.year == 2020 && generator.day == day) {
+            return generator;
+        }
+    }
+
+    throw std::runtime_error("No generator for day " + std::to_string(day));
+}
+
+// Random strings built from the bytes that matter to the validators, so
+// most values come close to valid and the edges get hit often.
+std::string randomValue(std::mt19937_64& engine)
+{
+    static constexpr std::string_view alphabet = "0123456789abcdefghijklmnopqrstuvwxyz#:cmin ";
+    auto length = engine() % 12;
+    std::string value;
+    for (size_t idx = 0; idx < length; ++idx) {
+        value += alphabet[engine() % alphabet.size()];
+    }
+
+    return value;
+}
+
+// Values around every rule's boundaries.
+std::vector<std::string> edgeValues()
+{
+    std::vector<std::string> values = {
+        "", "0", "#", "cm", "in", "#123abc", "#123abz", "#123ABC", "#123abcd", "#12345",
+        "amb", "blu", "brn", "gry", "grn", "hzl", "oth", "xry", "ambb", "am",
+        "000000001", "00000001", "0000000001", "12345678a",
+    };
+    for (auto number = 0; number <= 2100; ++number) {
+        values.push_back(std::to_string(number));
+        values.push_back(std::to_string(number) + "cm");
+        values.push_back(std::to_string(number) + "in");
+        values.push_back("0" + std::to_string(number));
+    }
+
+    return values;
+}
+
+size_t checkPassportRules(uint64_t seed)
+{
+    using aoc::y2020::Passport;
+
+    Checker checker;
+    auto rules = aoc::y2020::PassportRules::compile(aoc::y2020::PassportRules::defaultSpec());
+
+    auto check = [&](int field, const std::string& value) {
+        checker.expect(
+            rules.matches(field, value), Passport::validateField(field, value),
+            "field " + std::to_string(field) + " value \"" + value + "\"");
+    };
+
+    auto edges = edgeValues();
+    std::mt19937_64 engine(seed);
+    for (auto field = 0; field < Passport::NUM_FIELDS; ++field) {
+        for (const auto& value : edges) {
+            check(field, value);
+        }
+        for (auto idx = 0; idx < 100000; ++idx) {
+            check(field, randomValue(engine));
+        }
+    }
+
+    return checker.failures();
+}
+
+// Whether any k of values[first...] add up to goal, by trying them all.
+bool hasKSum(const std::vector<int>& values, size_t first, int64_t goal, int k)
+{
+    if (k == 0) {
+        return goal == 0;
+    }
+    for (auto idx = first; idx < values.size(); ++idx) {
+        if (hasKSum(values, idx + 1, goal - values[idx], k - 1)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Whether the addends add up to goal and each is a different entry of values.
+bool isSumOf(std::vector<int> addends, std::vector<int> values, int64_t goal)
+{
+    int64_t sum = 0;
+    for (auto addend : addends) {
+        sum += addend;
+    }
+
+    std::sort(addends.begin(), addends.end());
+    std::sort(values.begin(), values.end());
+    return sum == goal && std::includes(values.begin(), values.end(), addends.begin(), addends.end());
+}
+
+std::vector<int> randomEntries(std::mt19937_64& engine, size_t count, int lo, int hi)
+{
+    std::vector<int> values(count);
+    for (auto& value : values) {
+        value = lo + static_cast<int>(engine() % static_cast<uint64_t>(hi - lo + 1));
+    }
+
+    return values;
+}
+
+size_t checkKSum(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    for (auto round = 0; round < 300; ++round) {
+        // Narrow ranges for repeats, a wide one for the search without a bitmap.
+        auto wide = round % 10 == 0;
+        auto values = wide ? randomEntries(engine, 1 + engine() % 24, -(1 << 30), 1 << 30)
+                           : randomEntries(engine, 1 + engine() % 24, -20, 60);
+        aoc::y2020::KSum index(values);
+
+        for (auto k = 1; k <= 4; ++k) {
+            for (auto query = 0; query < 20; ++query) {
+                // Half the goals are made from real entries so most of them have an answer.
+                int64_t goal = static_cast<int64_t>(engine() % 240) - 40;
+                if (query % 2 == 0 && static_cast<size_t>(k) <= values.size()) {
+                    auto picked = values;
+                    std::shuffle(picked.begin(), picked.end(), engine);
+                    goal = 0;
+                    for (auto idx = 0; idx < k; ++idx) {
+                        goal += picked[idx];
+                    }
+                }
+
+                auto name = std::to_string(k) + "-sum to " + std::to_string(goal) + " over " + std::to_string(values.size());
+                auto addends = index.find(goal, k);
+                checker.expect(!addends.empty(), hasKSum(values, 0, goal, k), name + " found");
+                if (!addends.empty()) {
+                    checker.expect(addends.size(), static_cast<size_t>(k), name + " addend count");
+                    checker.expect(isSumOf(addends, values, goal), true, name + " addends");
+                    checker.expect(std::is_sorted(addends.begin(), addends.end()), true, name + " order");
+                }
+            }
+        }
+    }
+
+    return checker.failures();
+}
+
+constexpr aoc::SimdLevel kernelLevels[] = { aoc::SimdLevel::Scalar, aoc::SimdLevel::Avx2, aoc::SimdLevel::Avx512 };
+
+const char* levelName(aoc::SimdLevel level)
+{
+    switch (level) {
+    case aoc::SimdLevel::Scalar: return "scalar";
+    case aoc::SimdLevel::Avx2: return "avx2";
+    case aoc::SimdLevel::Avx512: return "avx512";
+    default: return "auto";
+    }
+}
+
+// Says so when the CPU can't run the level, so a skip shows in the log.
+bool isSupported(aoc::SimdLevel level)
+{
+    auto resolved = level;
+    if (!aoc::resolveSimdLevel(resolved)) {
+        std::cout << "Skipping " << levelName(level) << ", not supported" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+// "1,2,3", for printing.
+std::string joined(const std::vector<int>& values)
+{
+    std::string text;
+    for (auto value : values) {
+        text += (text.empty() ? "" : ",") + std::to_string(value);
+    }
+
+    return text;
+}
+
+size_t checkFindKernels(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    auto scalar = aoc::y2020::findKernel(aoc::SimdLevel::Scalar);
+
+    for (auto level : kernelLevels) {
+        if (!isSupported(level)) {
+            continue;
+        }
+
+        auto find = aoc::y2020::findKernel(level);
+        for (auto round = 0; round < 2000; ++round) {
+            // Every length up to a few vectors, so each tail path runs.
+            auto values = randomEntries(engine, engine() % 100, 0, 63);
+            auto needle = static_cast<int>(engine() % 80);
+            auto name = std::string(levelName(level)) + " find " + std::to_string(needle) + " in " + std::to_string(values.size());
+            checker.expect(find(values.data(), values.size(), needle), scalar(values.data(), values.size(), needle), name);
+
+            auto goal = static_cast<int64_t>(engine() % 200);
+            auto addends = aoc::y2020::bruteForceKSum(values, goal, 3, find);
+            name = std::string(levelName(level)) + " 3-sum to " + std::to_string(goal);
+            checker.expect(joined(addends), joined(aoc::y2020::bruteForceKSum(values, goal, 3, scalar)), name);
+            checker.expect(!addends.empty(), hasKSum(values, 0, goal, 3), name + " found");
+        }
+    }
+
+    return checker.failures();
+}
+
+// Products of every k of values[first...] that add up to goal.
+void collectProducts(
+    const std::vector<int>& values, size_t first, int64_t goal, int k, int64_t product, std::set<int64_t>& products)
+{
+    if (k == 0) {
+        if (goal == 0) {
+            products.insert(product);
+        }
+        return;
+    }
+    for (auto idx = first; idx < values.size(); ++idx) {
+        collectProducts(values, idx + 1, goal - values[idx], k - 1, product * values[idx], products);
+    }
+}
+
+size_t checkOnlineKSum(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    for (auto round = 0; round < 300; ++round) {
+        auto goal = static_cast<int>(engine() % 200);
+        auto values = randomEntries(engine, 1 + engine() % 40, -10, goal + 10);
+        aoc::y2020::OnlineKSum online(goal);
+
+        // After each entry an answer must be known exactly when the entries
+        // so far hold one, and come from them. Negative entries never count.
+        std::vector<int> usable;
+        for (size_t idx = 0; idx < values.size() && !online.done(); ++idx) {
+            online.add(values[idx]);
+            if (values[idx] >= 0) {
+                usable.push_back(values[idx]);
+            }
+
+            auto name = "goal " + std::to_string(goal) + " after " + std::to_string(idx + 1) + " entries";
+            checker.expect(online.entries(), idx + 1, name + " count");
+
+            std::set<int64_t> pairs;
+            std::set<int64_t> triples;
+            collectProducts(usable, 0, goal, 2, 1, pairs);
+            collectProducts(usable, 0, goal, 3, 1, triples);
+            checker.expect(online.hasPair(), !pairs.empty(), name + " pair");
+            checker.expect(online.hasTriple(), !triples.empty(), name + " triple");
+            if (online.hasPair()) {
+                checker.expect(pairs.count(online.pairProduct()) == 1, true, name + " pair product");
+            }
+            if (online.hasTriple()) {
+                checker.expect(triples.count(online.tripleProduct()) == 1, true, name + " triple product");
+            }
+        }
+    }
+
+    return checker.failures();
+}
+
+size_t checkLineStream(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    auto path = (std::filesystem::temp_directory_path() / ("aoc_checks_" + std::to_string(seed) + ".txt")).string();
+
+    for (auto round = 0; round < 50; ++round) {
+        // Lines of every length around the block size, some blank, some
+        // ending in "\r\n", and sometimes no newline after the last one.
+        std::vector<std::string> lines(engine() % 200);
+        std::string text;
+        for (auto& line : lines) {
+            line = std::string(engine() % 40, static_cast<char>('a' + engine() % 26));
+            text += line + (engine() % 4 == 0 ? "\r\n" : "\n");
+        }
+        if (!lines.empty() && !lines.back().empty() && engine() % 2 == 0) {
+            text.pop_back();
+            if (text.ends_with('\r')) {
+                text.pop_back();
+            }
+        }
+        std::ofstream(path, std::ios::binary) << text;
+
+        auto blockSize = 1 + engine() % 32;
+        aoc::LineStream stream(path, blockSize);
+        std::vector<std::string> read;
+        std::string_view line;
+        while (stream.next(line)) {
+            read.emplace_back(line);
+        }
+
+        auto name = std::to_string(lines.size()) + " lines in blocks of " + std::to_string(blockSize);
+        checker.expect(read.size(), lines.size(), name + " count");
+        for (size_t idx = 0; idx < read.size() && idx < lines.size(); ++idx) {
+            checker.expect(read[idx], lines[idx], name + " line " + std::to_string(idx));
+        }
+    }
+
+    std::filesystem::remove(path);
+    return checker.failures();
+}
+
+size_t checkQueryIndex(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    for (auto round = 0; round < 200; ++round) {
+        auto values = randomEntries(engine, 3 + engine() % 40, -50, 500);
+        aoc::y2020::KSum plain(values);
+        aoc::y2020::KSum tabled(values);
+        checker.expect(tabled.indexPairSums(), true, "pair sum table built");
+
+        // Every goal in range, as 2020_01_query does by default.
+        for (int64_t goal = -150; goal <= 1500; ++goal) {
+            auto name = "3-sum to " + std::to_string(goal) + " over " + std::to_string(values.size());
+            auto addends = tabled.find(goal, 3);
+            checker.expect(!addends.empty(), !plain.find(goal, 3).empty(), name + " found");
+            if (!addends.empty()) {
+                checker.expect(isSumOf(addends, values, goal), true, name + " addends");
+            }
+        }
+    }
+
+    // The ledger and goal files, blank lines skipped and anything else
+    // that isn't a number refused.
+    std::vector<int64_t> goals;
+    aoc::y2020::parseEntries(aoc::Input::fromString("2020\n\n-5\n9000000000\n"), goals);
+    checker.expect(goals.size(), size_t(3), "goals parsed");
+    checker.expect(goals.back(), int64_t(9000000000), "64-bit goal");
+
+    for (auto bad : { "1\nabc\n", "1\n 2\n", "1\n2x\n", "3000000000\n" }) {
+        std::string error;
+        try {
+            std::vector<int> entries;
+            aoc::y2020::parseEntries(aoc::Input::fromString(bad), entries);
+        } catch (const std::runtime_error& e) {
+            error = e.what();
+        }
+        checker.expect(error.empty(), false, "rejects \"" + std::string(bad) + "\"");
+        checker.expect(error.find(bad[0] == '1' ? "line 2" : "line 1") != std::string::npos, true, "line number in \"" + error + "\"");
+    }
+
+    return checker.failures();
+}
+
+size_t checkPasswordParser(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    for (auto round = 0; round < 20000; ++round) {
+        auto pos1 = static_cast<unsigned>(engine() % 70000);
+        auto pos2 = static_cast<unsigned>(engine() % 70000);
+        auto letter = static_cast<char>('a' + engine() % 26);
+        std::string password(engine() % 20, 'x');
+        for (auto& c : password) {
+            c = static_cast<char>('a' + engine() % 26);
+        }
+
+        // The line sits inside a larger buffer, as it does in the input.
+        auto line = std::to_string(pos1) + "-" + std::to_string(pos2) + " " + letter + ": " + password;
+        auto buffer = "\n" + line + "\n";
+        std::string_view view(buffer.data() + 1, line.size());
+
+        auto name = "\"" + line + "\"";
+        aoc::y2020::Entry entry;
+        auto fits = pos1 <= UINT16_MAX && pos2 <= UINT16_MAX;
+        checker.expect(aoc::y2020::tryParseEntry(view, buffer.data(), entry), fits, name);
+        if (fits) {
+            checker.expect(entry.pos1, static_cast<uint16_t>(pos1), name + " pos1");
+            checker.expect(entry.pos2, static_cast<uint16_t>(pos2), name + " pos2");
+            checker.expect(entry.letter, letter, name + " letter");
+            checker.expect(std::string(entry.password(buffer.data())), password, name + " password");
+        }
+
+        // Any separator out of place, or the line cut short, is refused.
+        auto broken = line;
+        auto separators = std::string("- : ");
+        auto at = broken.find(separators[engine() % separators.size()]);
+        broken[at] = '_';
+        checker.expect(aoc::y2020::tryParseEntry(broken, broken.data(), entry), false, "\"" + broken + "\"");
+
+        auto cut = line.substr(0, line.find(':') + engine() % 2);
+        checker.expect(aoc::y2020::tryParseEntry(cut, cut.data(), entry), false, "\"" + cut + "\"");
+    }
+
+    // The longest password the length field holds, and one past it.
+    for (size_t length : { size_t(UINT16_MAX), size_t(UINT16_MAX) + 1 }) {
+        auto line = "1-2 a: " + std::string(length, 'a');
+        aoc::y2020::Entry entry;
+        checker.expect(
+            aoc::y2020::tryParseEntry(line, line.data(), entry), length <= UINT16_MAX,
+            "password of " + std::to_string(length) + " bytes");
+    }
+
+    return checker.failures();
+}
+
+// Random entries with passwords of up to 80 bytes and positions that are
+// often past the end of the password.
+std::string randomPasswords(std::mt19937_64& engine, size_t count)
+{
+    std::string text;
+    for (size_t idx = 0; idx < count; ++idx) {
+        auto length = engine() % 4 == 0 ? engine() % 80 : engine() % 20;
+        std::string password(length, 'a');
+        for (auto& c : password) {
+            c = static_cast<char>('a' + engine() % 3);
+        }
+        text += std::to_string(engine() % (length + 3)) + "-" + std::to_string(engine() % (length + 3)) + " "
+            + static_cast<char>('a' + engine() % 3) + ": " + password + "\n";
+    }
+
+    return text;
+}
+
+size_t checkPasswordKernels(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+
+    std::vector<std::pair<std::string, std::string>> inputs;
+    for (auto scale : { 1, 7 }) {
+        inputs.emplace_back(generatorFor(2).generate(scale, seed).input, "generated at scale " + std::to_string(scale));
+    }
+    for (auto count : { 1, 3, 9, 17, 1000 }) {
+        // No newline at the end, so a kernel reading past the buffer would show.
+        auto text = randomPasswords(engine, count);
+        text.pop_back();
+        inputs.emplace_back(text, std::to_string(count) + " random entries");
+    }
+
+    for (const auto& [buffer, inputName] : inputs) {
+        aoc::y2020::PasswordTable table;
+        size_t part1 = 0;
+        size_t part2 = 0;
+        for (auto line : aoc::LineRange(buffer, false)) {
+            aoc::y2020::Entry entry;
+            if (aoc::y2020::tryParseEntry(line, buffer.data(), entry)) {
+                table.add(entry);
+                part1 += aoc::y2020::validatePasswordPart1(entry, buffer.data());
+                part2 += aoc::y2020::validatePasswordPart2(entry, buffer.data());
+            }
+        }
+
+        for (auto level : kernelLevels) {
+            if (!isSupported(level)) {
+                continue;
+            }
+
+            auto name = std::string(levelName(level)) + " on " + inputName;
+            checker.expect(table.countValidPart1(buffer, level), part1, name + " part 1");
+            checker.expect(table.countValidPart2(buffer, level), part2, name + " part 2");
+        }
+    }
+
+    return checker.failures();
+}
+
+std::vector<std::string> randomRows(std::mt19937_64& engine, size_t width, size_t height)
+{
+    std::vector<std::string> rows(height, std::string(width, '.'));
+    for (auto& row : rows) {
+        for (auto& cell : row) {
+            cell = engine() % 4 == 0 ? '#' : '.';
+        }
+    }
+
+    return rows;
+}
+
+// Trees on a slope by walking it step by step.
+size_t countTreesSlowly(const std::vector<std::string>& rows, aoc::y2020::Slope slope)
+{
+    size_t trees = 0;
+    for (size_t k = 1; k * slope.dy < rows.size(); ++k) {
+        const auto& row = rows[k * slope.dy];
+        trees += row[k * slope.dx % row.size()] == '#';
+    }
+
+    return trees;
+}
+
+std::vector<aoc::y2020::Slope> randomSlopes(std::mt19937_64& engine, size_t count)
+{
+    std::vector<aoc::y2020::Slope> slopes(count);
+    for (auto& slope : slopes) {
+        slope = { engine() % 100, 1 + engine() % 5 };
+    }
+
+    return slopes;
+}
+
+size_t checkGridView(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    for (auto round = 0; round < 200; ++round) {
+        auto width = 1 + engine() % 100;
+        auto height = 1 + engine() % 600;
+        auto rows = randomRows(engine, width, height);
+        auto lineEnd = engine() % 2 == 0 ? "\n" : "\r\n";
+        std::string text;
+        for (const auto& row : rows) {
+            text += row + lineEnd;
+        }
+
+        auto name = std::to_string(width) + "x" + std::to_string(height);
+        aoc::y2020::GridView grid(text);
+        checker.expect(grid.width(), width, name + " width");
+        checker.expect(grid.height(), height, name + " height");
+        for (size_t y = 0; y < height; ++y) {
+            checker.expect(std::string(grid.row(y), width), rows[y], name + " row " + std::to_string(y));
+        }
+
+        // Both grids, one thread and several, against walking each slope.
+        aoc::y2020::TreeMap map(grid);
+        auto slopes = randomSlopes(engine, 1 + engine() % 12);
+        auto threads = 1 + engine() % 4;
+        auto viewed = grid.countTrees(slopes, threads);
+        auto packed = map.countTrees(slopes, threads);
+        for (size_t idx = 0; idx < slopes.size(); ++idx) {
+            auto slopeName = name + " slope " + std::to_string(slopes[idx].dx) + "," + std::to_string(slopes[idx].dy);
+            auto expected = countTreesSlowly(rows, slopes[idx]);
+            checker.expect(viewed[idx], expected, slopeName + " on the view");
+            checker.expect(packed[idx], expected, slopeName + " on the packed map");
+        }
+
+        // A second row one wider, or a first line ending unlike the rest, is refused.
+        if (height > 1) {
+            auto wider = text;
+            wider.insert(text.find('\n') + 1, ".");
+            auto mixed = text;
+            if (std::string_view(lineEnd) == "\n") {
+                mixed.insert(text.find('\n'), "\r");
+            } else {
+                mixed.erase(text.find('\r'), 1);
+            }
+
+            for (const auto& broken : { wider, mixed }) {
+                auto refused = false;
+                try {
+                    aoc::y2020::GridView bad(broken);
+                } catch (const std::runtime_error&) {
+                    refused = true;
+                }
+                checker.expect(refused, true, name + " with a malformed row");
+            }
+        }
+    }
+
+    return checker.failures();
+}
+
+size_t checkTrackedMap(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    for (auto round = 0; round < 100; ++round) {
+        auto width = 1 + engine() % 70;
+        auto rows = randomRows(engine, width, 1 + engine() % 200);
+        auto slopes = randomSlopes(engine, 1 + engine() % 6);
+
+        // Slopes registered before the rows arrive, then rows appended and
+        // cells edited at random, counts compared after every change.
+        aoc::y2020::TrackedMap map;
+        for (const auto& slope : slopes) {
+            map.addSlope(slope);
+        }
+
+        std::vector<std::string> current;
+        for (size_t step = 0; step < rows.size() * 3; ++step) {
+            std::string change;
+            if (current.size() < rows.size() && (current.empty() || engine() % 3 == 0)) {
+                current.push_back(rows[current.size()]);
+                map.appendRow(current.back());
+                change = "row " + std::to_string(current.size());
+            } else {
+                auto x = engine() % width;
+                auto y = engine() % current.size();
+                auto tree = engine() % 2 == 0;
+                current[y][x] = tree ? '#' : '.';
+                if (tree) {
+                    map.setTree(x, y);
+                } else {
+                    map.clearTree(x, y);
+                }
+                change = (tree ? "+" : "-") + std::to_string(x) + "," + std::to_string(y);
+            }
+
+            for (size_t idx = 0; idx < slopes.size(); ++idx) {
+                checker.expect(
+                    map.trees(idx), countTreesSlowly(current, slopes[idx]), "slope " + std::to_string(idx) + " after " + change);
+            }
+        }
+
+        // Slopes added late count what is already there.
+        auto lateSlope = randomSlopes(engine, 1).front();
+        auto late = map.addSlope(lateSlope);
+        checker.expect(map.trees(late), countTreesSlowly(current, lateSlope), "slope added last");
+    }
+
+    // Empty and ragged rows are refused, and edits outside the map.
+    aoc::y2020::TrackedMap map;
+    map.addSlope({ 3, 1 });
+    auto throws = [&](auto&& change) {
+        try {
+            change();
+        } catch (const std::exception&) {
+            return true;
+        }
+        return false;
+    };
+    checker.expect(throws([&] { map.appendRow(""); }), true, "empty first row");
+    map.appendRow("..#");
+    checker.expect(throws([&] { map.appendRow("...."); }), true, "wider row");
+    checker.expect(throws([&] { map.appendRow(""); }), true, "empty row");
+    checker.expect(throws([&] { map.setTree(3, 0); }), true, "tree past the right edge");
+    checker.expect(throws([&] { map.setTree(0, 1); }), true, "tree below the map");
+    checker.expect(map.trees(0), size_t(0), "count after refused changes");
+
+    return checker.failures();
+}
+
+size_t checkPassportScanner(uint64_t seed)
+{
+    constexpr uint8_t required = 0xFF - (1 << aoc::y2020::Passport::COUNTRY_ID);
+
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    auto rules = aoc::y2020::PassportRules::compile(aoc::y2020::PassportRules::defaultSpec());
+    for (auto scale : { 1, 5 }) {
+        auto generated = generatorFor(4).generate(scale, seed);
+
+        // The same batch with "\r\n" line endings must count the same.
+        std::string crlf;
+        for (auto c : generated.input) {
+            crlf += c == '\n' ? "\r\n" : std::string(1, c);
+        }
+
+        auto input = aoc::Input::fromString(generated.input);
+        std::vector<std::string_view> records;
+        for (auto record : input.records()) {
+            records.push_back(record);
+        }
+
+        for (const auto* text : { &generated.input, &crlf }) {
+            for (auto maxPiece : { size_t(1), size_t(7), size_t(4096) }) {
+                for (auto withRules : { false, true }) {
+                    // Pieces of random size, so every field, line break and
+                    // blank line is split at every point somewhere.
+                    aoc::y2020::PassportScanner scanner(required, withRules ? &rules : nullptr);
+                    std::string_view rest(*text);
+                    while (!rest.empty()) {
+                        auto length = std::min<size_t>(rest.size(), 1 + engine() % maxPiece);
+                        scanner.feed(rest.substr(0, length));
+                        rest.remove_prefix(length);
+                    }
+                    scanner.finish();
+
+                    auto name = std::string(text == &crlf ? "crlf" : "lf") + " at scale " + std::to_string(scale)
+                        + " in pieces of up to " + std::to_string(maxPiece) + (withRules ? " with rules" : "");
+                    checker.expect(scanner.records(), records.size(), name + " records");
+                    checker.expect(std::to_string(scanner.present()), generated.part1, name + " part 1");
+                    checker.expect(std::to_string(scanner.valid()), generated.part2, name + " part 2");
+                }
+            }
+        }
+    }
+
+    // A field longer than the carry buffer still counts as present.
+    aoc::y2020::PassportScanner scanner(required);
+    scanner.feed("byr:1980 iyr:2015 eyr:2025 hgt:180cm hcl:#123abc ecl:brn pid:" + std::string(100, '0'));
+    scanner.finish();
+    checker.expect(scanner.present(), size_t(1), "long field present");
+    checker.expect(scanner.valid(), size_t(0), "long field valid");
+
+    return checker.failures();
+}
+
+std::string randomPass(std::mt19937_64& engine)
+{
+    std::string pass(10, 'F');
+    for (size_t idx = 0; idx < pass.size(); ++idx) {
+        auto one = engine() % 2 == 0;
+        pass[idx] = idx < 7 ? (one ? 'B' : 'F') : (one ? 'R' : 'L');
+    }
+
+    return pass;
+}
+
+// B and R are the one bits, read a letter at a time.
+uint16_t decodeSlowly(std::string_view pass)
+{
+    uint16_t id = 0;
+    for (auto c : pass) {
+        id = static_cast<uint16_t>(id << 1 | (c == 'B' || c == 'R'));
+    }
+
+    return id;
+}
+
+size_t checkSeatKernels(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+
+    std::vector<std::pair<std::string, std::string>> inputs;
+    for (auto scale : { 1, 13 }) {
+        inputs.emplace_back(generatorFor(5).generate(scale, seed).input, "generated at scale " + std::to_string(scale));
+    }
+    for (auto round = 0; round < 200; ++round) {
+        // Every count around the kernels' block sizes, LF or CRLF, blank
+        // lines between some passes and sometimes no newline at the end.
+        std::string text;
+        std::string lineEnd = engine() % 2 == 0 ? "\n" : "\r\n";
+        auto passes = engine() % 40;
+        for (size_t idx = 0; idx < passes; ++idx) {
+            text += randomPass(engine) + lineEnd;
+            if (engine() % 8 == 0) {
+                text += lineEnd;
+            }
+        }
+        if (!text.empty() && engine() % 2 == 0) {
+            text.resize(text.size() - lineEnd.size());
+        }
+        inputs.emplace_back(text, std::to_string(passes) + " random passes");
+    }
+
+    for (const auto& [text, inputName] : inputs) {
+        std::vector<uint16_t> expected;
+        for (auto line : aoc::LineRange(text, false)) {
+            if (!line.empty()) {
+                expected.push_back(decodeSlowly(line));
+            }
+        }
+
+        for (auto level : kernelLevels) {
+            if (!isSupported(level)) {
+                continue;
+            }
+
+            std::vector<uint16_t> ids;
+            aoc::y2020::decodeSeats(text, level, ids);
+            auto name = std::string(levelName(level)) + " on " + inputName;
+            checker.expect(ids.size(), expected.size(), name + " pass count");
+            for (size_t idx = 0; idx < ids.size() && idx < expected.size(); ++idx) {
+                checker.expect(ids[idx], expected[idx], name + " pass " + std::to_string(idx));
+            }
+
+            // One pass a letter short, anywhere among good ones, is refused.
+            auto broken = text + (text.empty() || text.back() == '\n' ? "" : "\n");
+            std::vector<size_t> lineStarts = { 0 };
+            for (size_t at = 0; at + 1 < broken.size(); ++at) {
+                if (broken[at] == '\n') {
+                    lineStarts.push_back(at + 1);
+                }
+            }
+            broken.insert(lineStarts[engine() % lineStarts.size()], randomPass(engine).substr(1) + "\n");
+            auto refused = false;
+            try {
+                ids.clear();
+                aoc::y2020::decodeSeats(broken, level, ids);
+            } catch (const std::runtime_error&) {
+                refused = true;
+            }
+            checker.expect(refused, true, name + " with a short pass");
+        }
+    }
+
+    return checker.failures();
+}
+
+// The lowest free seat with both neighbours taken, seat by seat.
+std::optional<uint32_t> findGapSlowly(const std::vector<bool>& taken)
+{
+    for (uint32_t seat = 1; seat + 1 < taken.size(); ++seat) {
+        if (!taken[seat] && taken[seat - 1] && taken[seat + 1]) {
+            return seat;
+        }
+    }
+
+    return std::nullopt;
+}
+
+size_t checkFlights(uint64_t seed)
+{
+    struct Expected
+    {
+        std::string id;
+        uint32_t highest = 0;
+        size_t passes = 0;
+        std::vector<bool> taken = std::vector<bool>(aoc::y2020::SeatMap::seatCount, false);
+    };
+
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    for (auto round = 0; round < 60; ++round) {
+        // Bare passes are one flight with no ID, keyed ones spread over a few.
+        auto keyed = round % 2 == 1;
+        auto flightCount = keyed ? 1 + engine() % 5 : 1;
+        std::vector<Expected> expected;
+        std::string text;
+        auto passes = engine() % 3000;
+        for (size_t idx = 0; idx < passes; ++idx) {
+            auto flight = keyed ? "F" + std::to_string(engine() % flightCount) : std::string();
+            auto pass = randomPass(engine);
+            text += (keyed ? flight + " " : "") + pass + (engine() % 50 == 0 ? "\n\n" : "\n");
+
+            auto found = std::find_if(expected.begin(), expected.end(), [&](const Expected& e) { return e.id == flight; });
+            if (found == expected.end()) {
+                found = expected.insert(expected.end(), Expected{ flight });
+            }
+            auto id = decodeSlowly(pass);
+            found->highest = std::max<uint32_t>(found->highest, id);
+            ++found->passes;
+            found->taken[id] = true;
+        }
+
+        for (auto level : kernelLevels) {
+            if (!isSupported(level)) {
+                continue;
+            }
+
+            for (size_t threads : { 1, 2, 3, 8 }) {
+                auto flights = aoc::y2020::scanFlights(text, level, threads);
+                auto name = std::string(levelName(level)) + (keyed ? " keyed" : " bare") + " with " + std::to_string(passes)
+                    + " passes on " + std::to_string(threads) + " threads";
+                checker.expect(flights.size(), expected.size(), name + " flight count");
+                for (size_t idx = 0; idx < flights.size() && idx < expected.size(); ++idx) {
+                    const auto& flight = flights[idx];
+                    auto flightName = name + " flight " + std::to_string(idx);
+                    checker.expect(flight.id, expected[idx].id, flightName + " ID");
+                    checker.expect(flight.highest, expected[idx].highest, flightName + " highest");
+                    checker.expect(flight.passes, expected[idx].passes, flightName + " passes");
+                    for (uint32_t seat = 0; seat < aoc::y2020::SeatMap::seatCount; ++seat) {
+                        checker.expect(
+                            flight.seats.test(seat), bool(expected[idx].taken[seat]), flightName + " seat " + std::to_string(seat));
+                    }
+
+                    auto gap = flight.seats.findGap();
+                    auto expectedGap = findGapSlowly(expected[idx].taken);
+                    checker.expect(gap.value_or(0), expectedGap.value_or(0), flightName + " gap");
+                    checker.expect(gap.has_value(), expectedGap.has_value(), flightName + " has a gap");
+                }
+            }
+        }
+    }
+
+    return checker.failures();
+}
+
+size_t checkSeatIndex(uint64_t seed)
+{
+    using aoc::y2020::SeatIndex;
+
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    for (size_t seats : { 1, 2, 63, 64, 65, 1000, 5000 }) {
+        SeatIndex index(seats);
+        std::vector<bool> taken(seats, false);
+
+        // Linear scans over a plain bitmap.
+        auto nextFree = [&](size_t from) {
+            for (auto seat = from; seat < seats; ++seat) {
+                if (!taken[seat]) {
+                    return seat;
+                }
+            }
+            return SeatIndex::npos;
+        };
+        auto nextGap = [&](size_t from) {
+            for (auto seat = std::max<size_t>(from, 1); seat + 1 < seats; ++seat) {
+                if (!taken[seat] && taken[seat - 1] && taken[seat + 1]) {
+                    return seat;
+                }
+            }
+            return SeatIndex::npos;
+        };
+
+        auto name = std::to_string(seats) + " seats";
+        size_t count = 0;
+        for (size_t op = 0; op < seats * 20; ++op) {
+            auto seat = engine() % seats;
+            if (engine() % 3 != 0) {
+                checker.expect(index.insert(seat), !taken[seat], name + " insert " + std::to_string(seat));
+                count += !taken[seat];
+                taken[seat] = true;
+            } else {
+                checker.expect(index.remove(seat), bool(taken[seat]), name + " remove " + std::to_string(seat));
+                count -= taken[seat];
+                taken[seat] = false;
+            }
+
+            auto from = engine() % seats;
+            checker.expect(index.taken(), count, name + " taken count");
+            checker.expect(index.isTaken(from), bool(taken[from]), name + " taken " + std::to_string(from));
+            checker.expect(index.nextFree(from), nextFree(from), name + " next free from " + std::to_string(from));
+            checker.expect(index.nextGap(from), nextGap(from), name + " next gap from " + std::to_string(from));
+        }
+
+        auto refused = false;
+        try {
+            index.insert(seats);
+        } catch (const std::out_of_range&) {
+            refused = true;
+        }
+        checker.expect(refused, true, name + " insert past the end");
+    }
+
+    return checker.failures();
+}
+
+struct CustomsBatch
+{
+    std::string text;
+    size_t anyone = 0;
+    size_t everyone = 0;
+    size_t groups = 0;
+};
+
+// Random groups with LF or CRLF line endings and answers of up to 70
+// letters, repeats included, so lines cross the kernels' 32 byte loads.
+CustomsBatch randomCustoms(std::mt19937_64& engine)
+{
+    CustomsBatch batch;
+    std::string lineEnd = engine() % 2 == 0 ? "\n" : "\r\n";
+    auto groups = engine() % 60;
+    for (size_t group = 0; group < groups; ++group) {
+        std::set<char> anyone;
+        std::set<char> everyone;
+        auto people = 1 + engine() % 5;
+        for (size_t person = 0; person < people; ++person) {
+            std::set<char> answers;
+            std::string line(engine() % 4 == 0 ? 1 + engine() % 70 : 1 + engine() % 10, 'a');
+            for (auto& c : line) {
+                c = static_cast<char>('a' + engine() % 26);
+                answers.insert(c);
+            }
+
+            anyone.insert(answers.begin(), answers.end());
+            if (person == 0) {
+                everyone = answers;
+            } else {
+                std::erase_if(everyone, [&](char c) { return !answers.count(c); });
+            }
+            batch.text += line + lineEnd;
+        }
+
+        batch.anyone += anyone.size();
+        batch.everyone += everyone.size();
+        ++batch.groups;
+        batch.text += lineEnd;
+    }
+
+    // Sometimes no blank line, or no newline at all, after the last group.
+    if (!batch.text.empty() && engine() % 2 == 0) {
+        batch.text.resize(batch.text.size() - lineEnd.size() * (1 + engine() % 2));
+    }
+
+    return batch;
+}
+
+size_t checkCustomsKernels(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+
+    std::vector<std::pair<CustomsBatch, std::string>> inputs;
+    for (auto scale : { 1, 11 }) {
+        auto generated = generatorFor(6).generate(scale, seed);
+        CustomsBatch batch;
+        batch.text = std::move(generated.input);
+        batch.anyone = std::stoull(generated.part1);
+        batch.everyone = std::stoull(generated.part2);
+        for ([[maybe_unused]] auto record : aoc::LineRange(batch.text, true)) {
+            ++batch.groups;
+        }
+        inputs.emplace_back(std::move(batch), "generated at scale " + std::to_string(scale));
+    }
+    for (auto round = 0; round < 300; ++round) {
+        auto batch = randomCustoms(engine);
+        auto name = std::to_string(batch.groups) + " random groups";
+        inputs.emplace_back(std::move(batch), name);
+    }
+
+    for (const auto& [batch, inputName] : inputs) {
+        for (auto level : kernelLevels) {
+            if (!isSupported(level)) {
+                continue;
+            }
+
+            aoc::y2020::CustomsCounter counter(level);
+            counter.feed(batch.text);
+            counter.finish();
+
+            auto name = std::string(levelName(level)) + " on " + inputName;
+            checker.expect(counter.anyone(), batch.anyone, name + " part 1");
+            checker.expect(counter.everyone(), batch.everyone, name + " part 2");
+            checker.expect(counter.groups(), batch.groups, name + " groups");
+        }
+    }
+
+    return checker.failures();
+}
+
+size_t checkCustomsStream(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    auto path = (std::filesystem::temp_directory_path() / ("aoc_checks_customs_" + std::to_string(seed) + ".txt")).string();
+
+    for (auto round = 0; round < 200; ++round) {
+        auto batch = randomCustoms(engine);
+        for (auto level : kernelLevels) {
+            if (!isSupported(level)) {
+                continue;
+            }
+
+            // Pieces cut anywhere, empty ones too: inside a line, between '\r' and '\n',
+            // or in a run of blank lines.
+            for (auto maxPiece : { size_t(1), size_t(5), size_t(300) }) {
+                aoc::y2020::CustomsCounter counter(level);
+                std::string_view rest(batch.text);
+                while (!rest.empty()) {
+                    auto length = std::min<size_t>(rest.size(), engine() % (maxPiece + 1));
+                    counter.feed(rest.substr(0, length));
+                    rest.remove_prefix(length);
+                }
+                counter.finish();
+
+                auto name = std::string(levelName(level)) + " on " + std::to_string(batch.groups)
+                    + " groups in pieces of up to " + std::to_string(maxPiece);
+                checker.expect(counter.anyone(), batch.anyone, name + " part 1");
+                checker.expect(counter.everyone(), batch.everyone, name + " part 2");
+                checker.expect(counter.groups(), batch.groups, name + " groups");
+            }
+        }
+
+        // The blocks LineStream hands out add up to the file, as 2020_06_stream reads it.
+        std::ofstream(path, std::ios::binary) << batch.text;
+        aoc::LineStream stream(path, 1 + engine() % 64);
+        std::string blocks;
+        std::string_view block;
+        while (stream.nextBlock(block)) {
+            blocks += block;
+        }
+        checker.expect(blocks == batch.text, true, "blocks of " + std::to_string(batch.groups) + " groups");
+    }
+
+    std::filesystem::remove(path);
+    return checker.failures();
+}
+
+size_t checkParseCache(uint64_t seed)
+{
+    Checker checker;
+    std::mt19937_64 engine(seed);
+    auto dir = std::filesystem::temp_directory_path() / ("aoc_checks_cache_" + std::to_string(seed));
+    std::filesystem::create_directories(dir);
+
+    // Sections of several element sizes, one of them empty, come back as written.
+    std::vector<uint64_t> words(engine() % 1000);
+    std::vector<uint16_t> shorts(1 + 2 * (engine() % 500));
+    // The last section fills its 64 bytes, so the file ends with it rather than padding.
+    std::string bytes(64 * (1 + engine() % 3), 'x');
+    for (auto& word : words) {
+        word = engine();
+    }
+    for (auto& value : shorts) {
+        value = static_cast<uint16_t>(engine());
+    }
+    for (auto& c : bytes) {
+        c = static_cast<char>(engine());
+    }
+
+    std::string input = "1-3 a: abcde\n";
+    auto key = aoc::ParseCacheKey::of(2020, 2, 1, input);
+    auto path = (dir / key.fileName()).string();
+    aoc::ParseCacheWriter writer;
+    writer.add(words);
+    writer.add(shorts);
+    writer.add(std::vector<uint32_t>());
+    writer.addBytes(bytes.data(), bytes.size());
+    writer.write(path, key);
+
+    auto cache = aoc::ParseCache::open(path, key);
+    checker.expect(cache != nullptr, true, "cache opens");
+    if (cache != nullptr) {
+        checker.expect(cache->sections(), size_t(4), "section count");
+        auto mappedWords = cache->section<uint64_t>(0);
+        auto mappedShorts = cache->section<uint16_t>(1);
+        checker.expect(std::vector<uint64_t>(mappedWords.begin(), mappedWords.end()) == words, true, "64-bit section");
+        checker.expect(std::vector<uint16_t>(mappedShorts.begin(), mappedShorts.end()) == shorts, true, "16-bit section");
+        checker.expect(cache->section<uint32_t>(2).size(), size_t(0), "empty section");
+        auto mappedBytes = cache->section<char>(3);
+        checker.expect(std::string(mappedBytes.begin(), mappedBytes.end()), bytes, "byte section");
+        for (size_t idx = 0; idx < cache->sections(); ++idx) {
+            auto address = reinterpret_cast<uintptr_t>(cache->section<char>(idx).data());
+            checker.expect(address % 64, uintptr_t(0), "section " + std::to_string(idx) + " alignment");
+        }
+
+        auto refused = false;
+        try {
+            // An odd number of 16-bit values is never a whole number of 64-bit ones.
+            cache->section<uint64_t>(1);
+        } catch (const std::runtime_error&) {
+            refused = true;
+        }
+        checker.expect(refused, true, "section of partial elements");
+    }
+
+    // Anything that doesn't match the key is a miss.
+    auto misses = [&](const aoc::ParseCacheKey& other, const std::string& name) {
+        checker.expect(aoc::ParseCache::open(path, other) == nullptr, true, name + " is a miss");
+    };
+    misses(aoc::ParseCacheKey::of(2020, 2, 2, input), "another version");
+    misses(aoc::ParseCacheKey::of(2020, 3, 1, input), "another day");
+    misses(aoc::ParseCacheKey::of(2020, 2, 1, "1-3 a: abcdf\n"), "another input");
+    checker.expect(aoc::ParseCache::open((dir / "missing.bin").string(), key) == nullptr, true, "missing file is a miss");
+
+    // So is a damaged file, cut short or with its magic overwritten.
+    std::string content;
+    {
+        std::ifstream file(path, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    auto damaged = (dir / "damaged.bin").string();
+    for (auto cut : { size_t(0), size_t(7), size_t(40), content.size() - 1 }) {
+        std::ofstream(damaged, std::ios::binary) << content.substr(0, cut);
+        checker.expect(aoc::ParseCache::open(damaged, key) == nullptr, true, "file cut to " + std::to_string(cut) + " bytes");
+    }
+    auto badMagic = content;
+    badMagic[0] ^= 1;
+    std::ofstream(damaged, std::ios::binary) << badMagic;
+    checker.expect(aoc::ParseCache::open(damaged, key) == nullptr, true, "bad magic");
+
+    checker.expect(aoc::contentHash("") != aoc::contentHash(std::string(1, '\0')), true, "empty hash");
+
+    // Every day that caches gives the same answers from the cache as from
+    // the text.
+    size_t cachedDays = 0;
+    for (const auto& day : aoc::y2020::days()) {
+        auto parsed = day.create();
+        if (parsed->cacheVersion() == 0) {
+            continue;
+        }
+        ++cachedDays;
+
+        auto generated = generatorFor(day.day).generate(3, seed);
+        auto text = aoc::Input::fromString(generated.input);
+        parsed->parse(text);
+
+        auto dayKey = aoc::ParseCacheKey::of(day.year, day.day, parsed->cacheVersion(), text.data());
+        auto dayPath = (dir / dayKey.fileName()).string();
+        aoc::ParseCacheWriter dayWriter;
+        parsed->saveParsed(dayWriter);
+        dayWriter.write(dayPath, dayKey);
+
+        auto dayCache = aoc::ParseCache::open(dayPath, dayKey);
+        auto name = std::to_string(day.year) + "/" + std::to_string(day.day);
+        checker.expect(dayCache != nullptr, true, name + " cache opens");
+        if (dayCache == nullptr) {
+            continue;
+        }
+
+        auto loaded = day.create();
+        loaded->loadParsed(*dayCache, text);
+        checker.expect(loaded->part1(), generated.part1, name + " part 1 from the cache");
+        checker.expect(loaded->part2(), generated.part2, name + " part 2 from the cache");
+        checker.expect(parsed->part1(), generated.part1, name + " part 1 from the text");
+    }
+    checker.expect(cachedDays != 0, true, "days that cache");
+
+    std::filesystem::remove_all(dir);
+    return checker.failures();
+}
+
+const std::vector<std::pair<std::string_view, std::function<size_t(uint64_t)>>> checks = {
+    { "passport_rules", checkPassportRules },
+    { "ksum", checkKSum },
+    { "find_kernels", checkFindKernels },
+    { "online_ksum", checkOnlineKSum },
+    { "line_stream", checkLineStream },
+    { "query_index", checkQueryIndex },
+    { "password_parser", checkPasswordParser },
+    { "password_kernels", checkPasswordKernels },
+    { "grid_view", checkGridView },
+    { "tracked_map", checkTrackedMap },
+    { "passport_scanner", checkPassportScanner },
+    { "seat_kernels", checkSeatKernels },
+    { "flights", checkFlights },
+    { "seat_index", checkSeatIndex },
+    { "customs_kernels", checkCustomsKernels },
+    { "customs_stream", checkCustomsStream },
+    { "parse_cache", checkParseCache },
+};
+
+void printUsage(std::ostream& out)
+{
+    out << "Usage: aoc_checks <check> [--seed <n>]" << std::endl << "Checks:";
+    for (const auto& [name, check] : checks) {
+        out << " " << name;
+    }
+    out << std::endl;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    std::string_view name;
+    uint64_t seed = 2020;
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string_view arg = argv[idx];
+        if (arg == "--seed" && idx + 1 < argc) {
+            std::string_view value = argv[++idx];
+            auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), seed);
+            if (ec != std::errc() || ptr != value.data() + value.size()) {
+                std::cerr << "Error: bad seed " << value << std::endl;
+                return 1;
+            }
+        } else if (name.empty() && !arg.starts_with("-")) {
+            name = arg;
+        } else {
+            printUsage(std::cerr);
+            return 1;
+        }
+    }
+
+    for (const auto& [checkName, check] : checks) {
+        if (checkName != name) {
+            continue;
+        }
+
+        try {
+            auto failures = check(seed);
+            if (failures != 0) {
+                std::cerr << name << ": " << failures << " mismatches" << std::endl;
+                return 1;
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+
+        std::cout << name << ": ok" << std::endl;
+        return 0;
+    }
+
+    printUsage(std::cerr);
+    return 1;
+}
@@ -0,0 +1,390 @@
+#include "Generators.h"
+
+#include <algorithm>
+#include <bit>
+#include <random>
+#include <utility>
+
+#include "Product.h"
+
+namespace aoc {
+
+namespace {
+
+// mt19937_64 is fully specified by the standard, the distributions are not,
+// so do the range reduction by hand to keep inputs identical across compilers.
+class Random
+{
+public:
+    explicit Random(uint64_t seed)
+        : m_engine(seed)
+    {}
+
+    // Integer in [lo, hi].
+    int64_t range(int64_t lo, int64_t hi) { return lo + static_cast<int64_t>(m_engine() % static_cast<uint64_t>(hi - lo + 1)); }
+
+    bool chance(int percent) { return range(0, 99) < percent; }
+
+    char letter() { return static_cast<char>('a' + range(0, 25)); }
+
+    template<typename T>
+    void shuffle(std::vector<T>& values)
+    {
+        for (auto idx = values.size(); idx > 1; --idx) {
+            std::swap(values[idx - 1], values[range(0, idx - 1)]);
+        }
+    }
+
+private:
+    std::mt19937_64 m_engine;
+};
+
+/**
+ * Day 1: 200 entries per scale.
+ *
+ * Exactly one pair and one triple sum to 2020. Everything else is filler
+ * between 1011 and 2019, so two fillers can never pair up, and values that
+ * would complete a sum with the planted entries are left out.
+ **/
+Generated day01(size_t scale, uint64_t seed)
+{
+    constexpr int goal = 2020;
+    Random random(seed);
+
+    auto countSums = [&](const std::vector<int>& values, int k) {
+        auto count = 0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            for (size_t j = i + 1; j < values.size(); ++j) {
+                if (k == 2) {
+                    count += values[i] + values[j] == goal;
+                    continue;
+                }
+                for (size_t l = j + 1; l < values.size(); ++l) {
+                    count += values[i] + values[j] + values[l] == goal;
+                }
+            }
+        }
+        return count;
+    };
+
+    std::vector<int> planted;
+    do {
+        auto a = static_cast<int>(random.range(1, 1009));
+        auto c = static_cast<int>(random.range(300, 700));
+        auto d = static_cast<int>(random.range(311, 700));
+        planted = { a, goal - a, c, d, goal - c - d };
+    } while (countSums(planted, 2) != 1 || countSums(planted, 3) != 1);
+
+    std::vector<bool> excluded(goal, false);
+    for (size_t i = 0; i < planted.size(); ++i) {
+        excluded[planted[i]] = true;
+        excluded[goal - planted[i]] = true;
+        for (size_t j = i + 1; j < planted.size(); ++j) {
+            if (planted[i] + planted[j] < goal) {
+                excluded[goal - planted[i] - planted[j]] = true;
+            }
+        }
+    }
+
+    auto values = planted;
+    auto count = std::max<size_t>(200 * scale, planted.size());
+    while (values.size() < count) {
+        auto value = static_cast<int>(random.range(goal / 2 + 1, goal - 1));
+        if (!excluded[value]) {
+            values.push_back(value);
+        }
+    }
+    random.shuffle(values);
+
+    Generated generated;
+    generated.input.reserve(values.size() * 5);
+    for (auto value : values) {
+        generated.input += std::to_string(value);
+        generated.input += '\n';
+    }
+
+    generated.part1 = std::to_string(int64_t(planted[0]) * planted[1]);
+    generated.part2 = std::to_string(int64_t(planted[2]) * planted[3] * planted[4]);
+    return generated;
+}
+
+// Day 2: 1000 password entries per scale.
+Generated day02(size_t scale, uint64_t seed)
+{
+    Random random(seed);
+    Generated generated;
+    generated.input.reserve(scale * 1000 * 24);
+
+    size_t p1Answer = 0;
+    size_t p2Answer = 0;
+    std::string password;
+    for (size_t line = 0; line < scale * 1000; ++line) {
+        auto length = random.range(2, 20);
+        auto letter = random.letter();
+        auto pos1 = random.range(1, length - 1);
+        auto pos2 = random.range(pos1 + 1, length);
+
+        // Bias towards the policy letter so plenty of entries are valid.
+        password.clear();
+        for (auto idx = 0; idx < length; ++idx) {
+            password += random.chance(30) ? letter : random.letter();
+        }
+
+        auto count = std::count(password.begin(), password.end(), letter);
+        p1Answer += count >= pos1 && count <= pos2;
+        p2Answer += (password[pos1 - 1] == letter) != (password[pos2 - 1] == letter);
+
+        generated.input += std::to_string(pos1) + '-' + std::to_string(pos2) + ' ' + letter + ": " + password + '\n';
+    }
+
+    generated.part1 = std::to_string(p1Answer);
+    generated.part2 = std::to_string(p2Answer);
+    return generated;
+}
+
+// Day 3: 323 rows of 31 columns per scale.
+Generated day03(size_t scale, uint64_t seed)
+{
+    Random random(seed);
+    constexpr size_t width = 31;
+
+    // Keep the height odd so the down 2 slope lands exactly on the last row.
+    auto height = 323 * scale;
+    if (height % 2 == 0) {
+        ++height;
+    }
+
+    std::vector<std::string> rows(height, std::string(width, '.'));
+    for (auto& row : rows) {
+        for (auto& cell : row) {
+            cell = random.chance(25) ? '#' : '.';
+        }
+    }
+    rows[0][0] = '.';
+
+    auto countTrees = [&](size_t dx, size_t dy) {
+        uint64_t trees = 0;
+        for (size_t y = dy, x = dx % width; y < height; y += dy, x = (x + dx) % width) {
+            trees += rows[y][x] == '#';
+        }
+        return trees;
+    };
+
+    Generated generated;
+    generated.input.reserve(height * (width + 1));
+    for (const auto& row : rows) {
+        generated.input += row;
+        generated.input += '\n';
+    }
+
+    generated.part1 = std::to_string(countTrees(3, 1));
+    generated.part2 = exactProduct({ countTrees(1, 1), countTrees(3, 1), countTrees(5, 1), countTrees(7, 1), countTrees(1, 2) });
+    return generated;
+}
+
+// Day 4: 290 passports per scale, some fields missing and some invalid.
+Generated day04(size_t scale, uint64_t seed)
+{
+    Random random(seed);
+    static const char* eyeColors[] = { "amb", "blu", "brn", "gry", "grn", "hzl", "oth" };
+    static const char* badEyeColors[] = { "wat", "zzz", "xry", "gmt", "lzr" };
+    static const char* keys[] = { "byr", "iyr", "eyr", "hgt", "hcl", "ecl", "pid", "cid" };
+    constexpr auto countryId = 7;
+
+    auto year = [&](bool valid, int64_t lo, int64_t hi) {
+        if (valid) {
+            return std::to_string(random.range(lo, hi));
+        }
+        return std::to_string(random.chance(50) ? random.range(lo - 30, lo - 1) : random.range(hi + 1, hi + 30));
+    };
+
+    auto digits = [&](size_t count) {
+        std::string value;
+        for (size_t idx = 0; idx < count; ++idx) {
+            value += static_cast<char>('0' + random.range(0, 9));
+        }
+        return value;
+    };
+
+    auto hex = [&](size_t count) {
+        std::string value;
+        for (size_t idx = 0; idx < count; ++idx) {
+            value += "0123456789abcdef"[random.range(0, 15)];
+        }
+        return value;
+    };
+
+    auto makeValue = [&](int field, bool valid) -> std::string {
+        switch (field) {
+        case 0: return year(valid, 1920, 2002);
+        case 1: return year(valid, 2010, 2020);
+        case 2: return year(valid, 2020, 2030);
+        case 3:
+            if (valid) {
+                return random.chance(50)
+                    ? std::to_string(random.range(150, 193)) + "cm"
+                    : std::to_string(random.range(59, 76)) + "in";
+            }
+            switch (random.range(0, 2)) {
+            case 0: return std::to_string(random.chance(50) ? random.range(100, 149) : random.range(194, 220)) + "cm";
+            case 1: return std::to_string(random.chance(50) ? random.range(40, 58) : random.range(77, 99)) + "in";
+            default: return std::to_string(random.range(59, 193));
+            }
+        case 4:
+            if (valid) {
+                return "#" + hex(6);
+            }
+            return random.chance(50) ? hex(6) : "#" + hex(5) + "z";
+        case 5:
+            return valid ? eyeColors[random.range(0, 6)] : badEyeColors[random.range(0, 4)];
+        case 6:
+            return valid ? digits(9) : digits(random.chance(50) ? 8 : 10);
+        default:
+            return std::to_string(random.range(100, 350));
+        }
+    };
+
+    Generated generated;
+    generated.input.reserve(scale * 290 * 100);
+
+    size_t p1Answer = 0;
+    size_t p2Answer = 0;
+    std::vector<std::string> fields;
+    for (size_t passport = 0; passport < scale * 290; ++passport) {
+        auto present = true;
+        auto valid = true;
+        fields.clear();
+        for (auto field = 0; field < 8; ++field) {
+            if (!random.chance(field == countryId ? 50 : 92)) {
+                present &= field == countryId;
+                continue;
+            }
+
+            auto fieldValid = random.chance(93);
+            valid &= fieldValid || field == countryId;
+            fields.push_back(std::string(keys[field]) + ':' + makeValue(field, fieldValid));
+        }
+
+        p1Answer += present;
+        p2Answer += present && valid;
+
+        // Fields are separated by spaces or newlines, passports by a blank line.
+        random.shuffle(fields);
+        if (passport > 0) {
+            generated.input += '\n';
+        }
+        for (size_t idx = 0; idx < fields.size(); ++idx) {
+            generated.input += fields[idx];
+            generated.input += idx + 1 == fields.size() || random.chance(25) ? '\n' : ' ';
+        }
+    }
+
+    generated.part1 = std::to_string(p1Answer);
+    generated.part2 = std::to_string(p2Answer);
+    return generated;
+}
+
+// Day 5: one full flight per scale, all with the same missing seat.
+Generated day05(size_t scale, uint64_t seed)
+{
+    Random random(seed);
+    auto first = random.range(8, 100);
+    auto last = random.range(800, 1015);
+    auto mine = random.range(first + 1, last - 1);
+
+    Generated generated;
+    generated.input.reserve(scale * (last - first) * 11);
+
+    std::vector<int64_t> seats;
+    for (size_t flight = 0; flight < scale; ++flight) {
+        seats.clear();
+        for (auto seat = first; seat <= last; ++seat) {
+            if (seat != mine) {
+                seats.push_back(seat);
+            }
+        }
+        random.shuffle(seats);
+
+        for (auto seat : seats) {
+            for (auto bit = 9; bit >= 0; --bit) {
+                auto set = (seat >> bit) & 1;
+                generated.input += bit >= 3 ? (set ? 'B' : 'F') : (set ? 'R' : 'L');
+            }
+            generated.input += '\n';
+        }
+    }
+
+    generated.part1 = std::to_string(last);
+    generated.part2 = std::to_string(mine);
+    return generated;
+}
+
+// Day 6: 490 groups of one to five people per scale.
+Generated day06(size_t scale, uint64_t seed)
+{
+    Random random(seed);
+    Generated generated;
+    generated.input.reserve(scale * 490 * 20);
+
+    size_t p1Answer = 0;
+    size_t p2Answer = 0;
+    std::vector<char> letters;
+    for (size_t group = 0; group < scale * 490; ++group) {
+        uint32_t anyone = 0;
+        uint32_t everyone = (1u << 26) - 1;
+
+        if (group > 0) {
+            generated.input += '\n';
+        }
+
+        auto people = random.range(1, 5);
+        for (auto person = 0; person < people; ++person) {
+            // Each question has about a 1 in 3 chance of a yes.
+            uint32_t answers = 0;
+            for (auto question = 0; question < 26; ++question) {
+                answers |= random.chance(33) ? 1u << question : 0;
+            }
+            if (answers == 0) {
+                answers = 1u << random.range(0, 25);
+            }
+
+            anyone |= answers;
+            everyone &= answers;
+
+            letters.clear();
+            for (auto question = 0; question < 26; ++question) {
+                if (answers & (1u << question)) {
+                    letters.push_back(static_cast<char>('a' + question));
+                }
+            }
+            random.shuffle(letters);
+            generated.input.append(letters.begin(), letters.end());
+            generated.input += '\n';
+        }
+
+        p1Answer += std::popcount(anyone);
+        p2Answer += std::popcount(everyone);
+    }
+
+    generated.part1 = std::to_string(p1Answer);
+    generated.part2 = std::to_string(p2Answer);
+    return generated;
+}
+
+}
+
+const std::vector<Generator>& generators()
+{
+    static const std::vector<Generator> generators = {
+        { 2020, 1, day01 },
+        { 2020, 2, day02 },
+        { 2020, 3, day03 },
+        { 2020, 4, day04 },
+        { 2020, 5, day05 },
+        { 2020, 6, day06 },
+    };
+
+    return generators;
+}
+
+}
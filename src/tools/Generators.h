@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aoc {
+
+// A synthetic puzzle input along with the answers it should produce.
+struct Generated
+{
+    std::string input;
+    std::string part1;
+    std::string part2;
+};
+
+/**
+ * Produces valid inputs for a day at any size.
+ *
+ * A scale of 1 is roughly the size of a real puzzle input, larger scales grow
+ * the input linearly. The same seed always produces the same input on every
+ * platform.
+ **/
+struct Generator
+{
+    int year;
+    int day;
+    Generated (*generate)(size_t scale, uint64_t seed);
+};
+
+const std::vector<Generator>& generators();
+
+}
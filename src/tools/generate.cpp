@@ -0,0 +1,111 @@
+/**
+ * Writes a synthetic puzzle input and its expected answers.
+ *
+ *   aoc_generate <year> <day> [--scale <n>] [--seed <n>] [-o <file>]
+ *
+ * The input goes to stdout, or to <file> with the answers next to it in
+ * <file>.answers. The answers are always echoed to stderr.
+ **/
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "DayList.h"
+#include "Generators.h"
+
+namespace {
+
+void printUsage(std::ostream& out)
+{
+    out << "Usage: aoc_generate <year> <day> [--scale <n>] [--seed <n>] [-o <file>]" << std::endl;
+}
+
+// Throws if the file can't be written, the stream only says so by its state.
+void checkWritten(const std::ofstream& out, const std::string& path)
+{
+    if (!out.good()) {
+        throw std::runtime_error("Can't write " + path);
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    try {
+        std::vector<std::string> positional;
+        size_t scale = 1;
+        uint64_t seed = 2020;
+        std::string outputFile;
+        for (auto idx = 1; idx < argc; ++idx) {
+            std::string arg = argv[idx];
+            if (arg == "--help" || arg == "-h") {
+                printUsage(std::cout);
+                return 0;
+            } else if (arg == "--scale" && idx + 1 < argc) {
+                scale = aoc::parseCount(arg, argv[++idx], 1);
+            } else if (arg == "--seed" && idx + 1 < argc) {
+                seed = aoc::parseCount(arg, argv[++idx]);
+            } else if (arg == "-o" && idx + 1 < argc) {
+                outputFile = argv[++idx];
+            } else if (arg.starts_with("-") || positional.size() == 2) {
+                std::cerr << "Unexpected argument " << arg << "." << std::endl << std::endl;
+                printUsage(std::cerr);
+                return 1;
+            } else {
+                positional.push_back(std::move(arg));
+            }
+        }
+
+        if (positional.size() != 2) {
+            printUsage(std::cerr);
+            return 1;
+        }
+
+        auto year = aoc::parseYear(positional[0]);
+        auto days = aoc::parseDayList(positional[1]);
+        if (days.size() != 1) {
+            throw std::invalid_argument("Expected a single day, not " + positional[1]);
+        }
+        auto day = *days.begin();
+
+        for (const auto& generator : aoc::generators()) {
+            if (generator.year != year || generator.day != day) {
+                continue;
+            }
+
+            auto generated = generator.generate(scale, seed);
+            if (outputFile.empty()) {
+                std::cout << generated.input << std::flush;
+                if (!std::cout.good()) {
+                    throw std::runtime_error("Can't write to stdout");
+                }
+            } else {
+                std::ofstream input(outputFile, std::ios::binary);
+                input << generated.input << std::flush;
+                checkWritten(input, outputFile);
+
+                std::ofstream answers(outputFile + ".answers");
+                answers
+                    << "Part1: " << generated.part1 << std::endl
+                    << "Part2: " << generated.part2 << std::endl;
+                checkWritten(answers, outputFile + ".answers");
+            }
+
+            std::cerr
+                << "Part1: " << generated.part1 << std::endl
+                << "Part2: " << generated.part2 << std::endl;
+            return 0;
+        }
+
+        std::cerr << "No generator for " << year << " day " << day << "." << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+    }
+
+    return 1;
+}
@@ -0,0 +1,189 @@
+/**
+ * Runs each day over generated inputs of growing size and reports throughput.
+ *
+ *   aoc_scaling [year [days]] [options]
+ *
+ * Options:
+ *   --max-scale <n>         largest input, in multiples of a real input (default: 10000)
+ *   --runs <n>              timed iterations per size (default: 3)
+ *   --seed <n>              generator seed (default: 2020)
+ *   --time-limit <s>        stop growing a day once the next size would likely
+ *                           take longer than this per iteration (default: 10)
+ *   --format <fmt>          table or csv (default: table)
+ *
+ * Every run is checked against the generator's known answers.
+ **/
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "DayList.h"
+#include "Generators.h"
+#include "Input.h"
+#include "Year2020.h"
+
+namespace {
+
+struct Options
+{
+    size_t maxScale = 10000;
+    int runs = 3;
+    uint64_t seed = 2020;
+    double timeLimit = 10.0;
+    bool csv = false;
+};
+
+void printUsage(std::ostream& out)
+{
+    out
+        << "Usage: aoc_scaling [year [days]] [options]" << std::endl
+        << std::endl
+        << "  --max-scale <n>         largest input, in multiples of a real input (default: 10000)" << std::endl
+        << "  --runs <n>              timed iterations per size (default: 3)" << std::endl
+        << "  --seed <n>              generator seed (default: 2020)" << std::endl
+        << "  --time-limit <s>        per iteration time limit for growing a day (default: 10)" << std::endl
+        << "  --format <fmt>          table or csv (default: table)" << std::endl;
+}
+
+// A positive number of seconds, fractions allowed.
+double parseSeconds(const std::string& option, const std::string& text)
+{
+    double seconds = 0;
+    auto end = text.data() + text.size();
+    auto result = std::from_chars(text.data(), end, seconds);
+    if (text.empty() || result.ec != std::errc() || result.ptr != end || !(seconds > 0)) {
+        throw std::invalid_argument("Bad " + option + " \"" + text + "\", expected a number of seconds above 0");
+    }
+
+    return seconds;
+}
+
+void scaleDay(const aoc::Day& day, const aoc::Generator& generator, const Options& options)
+{
+    aoc::Benchmark benchmark(1, options.runs);
+    for (size_t scale = 1; scale <= options.maxScale; scale *= 10) {
+        auto generated = generator.generate(scale, options.seed);
+        auto lines = std::count(generated.input.begin(), generated.input.end(), '\n');
+        auto input = aoc::Input::fromString(std::move(generated.input));
+
+        std::string part1;
+        std::string part2;
+        auto solution = day.create();
+        auto stats = benchmark.run({
+            { "Parse", [&] { solution->parse(input); } },
+            { "Part1", [&] { part1 = solution->part1(); } },
+            { "Part2", [&] { part2 = solution->part2(); } },
+        });
+
+        auto median = std::max<double>(stats.back().median, 1.0);
+        auto megabytesPerSecond = input.size() * 1e3 / median;
+        auto megalinesPerSecond = lines * 1e3 / median;
+        auto check = part1 == generated.part1 && part2 == generated.part2 ? "ok" : "MISMATCH";
+
+        if (options.csv) {
+            std::cout
+                << day.year << "," << day.day << "," << scale << "," << input.size() << "," << lines << ","
+                << stats.back().median << "," << std::fixed << std::setprecision(2)
+                << megabytesPerSecond << "," << megalinesPerSecond << "," << check << std::endl;
+        } else {
+            std::cout
+                << std::left << std::setw(10) << (scale == 1 ? std::to_string(day.year) + "/" + std::to_string(day.day) : "")
+                << std::right << std::setw(8) << (std::to_string(scale) + "x")
+                << std::setw(14) << input.size()
+                << std::setw(12) << lines
+                << std::setw(14) << std::fixed << std::setprecision(3) << median / 1e6
+                << std::setw(12) << std::setprecision(1) << megabytesPerSecond
+                << std::setw(12) << std::setprecision(2) << megalinesPerSecond
+                << "  " << check << std::endl;
+        }
+
+        // Nothing scales better than linearly, so don't start a size we can't finish.
+        if (median * 10 > options.timeLimit * 1e9 && scale * 10 <= options.maxScale) {
+            if (!options.csv) {
+                std::cout << std::setw(18) << "" << "larger sizes skipped, over the time limit" << std::endl;
+            }
+            break;
+        }
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<aoc::Day> allDays(aoc::y2020::days());
+
+    try {
+        Options options;
+        std::vector<std::string> positional;
+        for (auto idx = 1; idx < argc; ++idx) {
+            std::string arg = argv[idx];
+            if (arg == "--help" || arg == "-h") {
+                printUsage(std::cout);
+                return 0;
+            } else if (arg == "--max-scale" && idx + 1 < argc) {
+                options.maxScale = aoc::parseCount(arg, argv[++idx], 1);
+            } else if (arg == "--runs" && idx + 1 < argc) {
+                options.runs = static_cast<int>(aoc::parseCount(arg, argv[++idx], 1));
+            } else if (arg == "--seed" && idx + 1 < argc) {
+                options.seed = aoc::parseCount(arg, argv[++idx]);
+            } else if (arg == "--time-limit" && idx + 1 < argc) {
+                options.timeLimit = parseSeconds(arg, argv[++idx]);
+            } else if (arg == "--format" && idx + 1 < argc) {
+                std::string format = argv[++idx];
+                if (format != "table" && format != "csv") {
+                    throw std::invalid_argument("Unknown format " + format);
+                }
+                options.csv = format == "csv";
+            } else if (arg.starts_with("-") || positional.size() == 2) {
+                // Unknown options, options missing their value and a third positional.
+                std::cerr << "Unexpected argument " << arg << "." << std::endl << std::endl;
+                printUsage(std::cerr);
+                return 1;
+            } else {
+                positional.push_back(std::move(arg));
+            }
+        }
+
+        auto year = positional.size() > 0 ? aoc::parseYear(positional[0]) : 0;
+        auto dayList = positional.size() > 1 ? aoc::parseDayList(positional[1]) : std::set<int>();
+
+        if (options.csv) {
+            std::cout << "year,day,scale,bytes,lines,median_ns,mb_per_s,mlines_per_s,check" << std::endl;
+        } else {
+            std::cout
+                << std::left << std::setw(10) << "Day"
+                << std::right << std::setw(8) << "Scale"
+                << std::setw(14) << "Bytes"
+                << std::setw(12) << "Lines"
+                << std::setw(14) << "Median(ms)"
+                << std::setw(12) << "MB/s"
+                << std::setw(12) << "Mlines/s" << "  Check" << std::endl;
+        }
+
+        for (const auto& day : allDays) {
+            if ((year != 0 && day.year != year) || (!dayList.empty() && !dayList.count(day.day))) {
+                continue;
+            }
+
+            for (const auto& generator : aoc::generators()) {
+                if (generator.year == day.year && generator.day == day.day) {
+                    scaleDay(day, generator, options);
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
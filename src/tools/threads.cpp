@@ -0,0 +1,187 @@
+/**
+ * Runs each day that takes a "threads" option over a generated input with
+ * 1 to N threads and reports how well it scales.
+ *
+ *   aoc_threads [year [days]] [options]
+ *
+ * Options:
+ *   --scale <n>             input size, in multiples of a real input (default: 1000)
+ *   --max-threads <n>       largest thread count to try (default: one per core)
+ *   --runs <n>              timed iterations per thread count (default: 5)
+ *   --seed <n>              generator seed (default: 2020)
+ *   --set <key>=<value>     passed to every day before the thread count
+ *   --format <fmt>          table or csv (default: table)
+ *
+ * Speedup is the single thread median over the median with n threads, and
+ * efficiency is the speedup divided by n. Every run is checked against the
+ * generator's known answers.
+ **/
+#include <algorithm>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.h"
+#include "DayList.h"
+#include "Generators.h"
+#include "Input.h"
+#include "Parallel.h"
+#include "Year2020.h"
+
+namespace {
+
+struct Options
+{
+    size_t scale = 1000;
+    size_t maxThreads = aoc::hardwareThreads();
+    int runs = 5;
+    uint64_t seed = 2020;
+    std::vector<std::pair<std::string, std::string>> settings;
+    bool csv = false;
+};
+
+void printUsage(std::ostream& out)
+{
+    out
+        << "Usage: aoc_threads [year [days]] [options]" << std::endl
+        << std::endl
+        << "  --scale <n>             input size, in multiples of a real input (default: 1000)" << std::endl
+        << "  --max-threads <n>       largest thread count to try (default: one per core)" << std::endl
+        << "  --runs <n>              timed iterations per thread count (default: 5)" << std::endl
+        << "  --seed <n>              generator seed (default: 2020)" << std::endl
+        << "  --set <key>=<value>     passed to every day before the thread count" << std::endl
+        << "  --format <fmt>          table or csv (default: table)" << std::endl;
+}
+
+void sweepDay(const aoc::Day& day, const aoc::Generator& generator, const Options& options)
+{
+    auto generated = generator.generate(options.scale, options.seed);
+    auto input = aoc::Input::fromString(std::move(generated.input));
+
+    aoc::Benchmark benchmark(1, options.runs);
+    double singleThread = 0;
+    for (size_t threads = 1; threads <= options.maxThreads; ++threads) {
+        auto solution = day.create();
+        for (const auto& [key, value] : options.settings) {
+            solution->setOption(key, value);
+        }
+        if (!solution->setOption("threads", std::to_string(threads))) {
+            return;
+        }
+
+        std::string part1;
+        std::string part2;
+        auto stats = benchmark.run({
+            { "Parse", [&] { solution->parse(input); } },
+            { "Part1", [&] { part1 = solution->part1(); } },
+            { "Part2", [&] { part2 = solution->part2(); } },
+        });
+
+        auto median = std::max<double>(stats.back().median, 1.0);
+        if (threads == 1) {
+            singleThread = median;
+        }
+        auto speedup = singleThread / median;
+        auto efficiency = speedup / threads;
+        auto check = part1 == generated.part1 && part2 == generated.part2 ? "ok" : "MISMATCH";
+
+        if (options.csv) {
+            std::cout
+                << day.year << "," << day.day << "," << options.scale << "," << threads << ","
+                << stats.back().median << "," << std::fixed << std::setprecision(3)
+                << speedup << "," << efficiency << "," << check << std::endl;
+        } else {
+            std::cout
+                << std::left << std::setw(10) << (threads == 1 ? std::to_string(day.year) + "/" + std::to_string(day.day) : "")
+                << std::right << std::setw(8) << threads
+                << std::setw(14) << std::fixed << std::setprecision(3) << median / 1e6
+                << std::setw(10) << std::setprecision(2) << speedup
+                << std::setw(11) << std::setprecision(0) << efficiency * 100 << "%"
+                << "  " << check << std::endl;
+        }
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<aoc::Day> allDays(aoc::y2020::days());
+
+    try {
+        Options options;
+        std::vector<std::string> positional;
+        for (auto idx = 1; idx < argc; ++idx) {
+            std::string arg = argv[idx];
+            if (arg == "--help" || arg == "-h") {
+                printUsage(std::cout);
+                return 0;
+            } else if (arg == "--scale" && idx + 1 < argc) {
+                options.scale = aoc::parseCount(arg, argv[++idx], 1);
+            } else if (arg == "--max-threads" && idx + 1 < argc) {
+                options.maxThreads = aoc::parseCount(arg, argv[++idx], 1);
+            } else if (arg == "--runs" && idx + 1 < argc) {
+                options.runs = static_cast<int>(aoc::parseCount(arg, argv[++idx], 1));
+            } else if (arg == "--seed" && idx + 1 < argc) {
+                options.seed = aoc::parseCount(arg, argv[++idx]);
+            } else if (arg == "--set" && idx + 1 < argc) {
+                std::string setting = argv[++idx];
+                auto equals = setting.find('=');
+                if (equals == std::string::npos) {
+                    throw std::invalid_argument("Expected --set <key>=<value>, not " + setting);
+                }
+                options.settings.emplace_back(setting.substr(0, equals), setting.substr(equals + 1));
+            } else if (arg == "--format" && idx + 1 < argc) {
+                std::string format = argv[++idx];
+                if (format != "table" && format != "csv") {
+                    throw std::invalid_argument("Unknown format " + format);
+                }
+                options.csv = format == "csv";
+            } else if (arg.starts_with("-") || positional.size() == 2) {
+                // Unknown options, options missing their value and a third positional.
+                std::cerr << "Unexpected argument " << arg << "." << std::endl << std::endl;
+                printUsage(std::cerr);
+                return 1;
+            } else {
+                positional.push_back(std::move(arg));
+            }
+        }
+
+        auto year = positional.size() > 0 ? aoc::parseYear(positional[0]) : 0;
+        auto dayList = positional.size() > 1 ? aoc::parseDayList(positional[1]) : std::set<int>();
+
+        if (options.csv) {
+            std::cout << "year,day,scale,threads,median_ns,speedup,efficiency,check" << std::endl;
+        } else {
+            std::cout
+                << std::left << std::setw(10) << "Day"
+                << std::right << std::setw(8) << "Threads"
+                << std::setw(14) << "Median(ms)"
+                << std::setw(10) << "Speedup"
+                << std::setw(12) << "Efficiency" << "  Check" << std::endl;
+        }
+
+        for (const auto& day : allDays) {
+            if ((year != 0 && day.year != year) || (!dayList.empty() && !dayList.count(day.day))) {
+                continue;
+            }
+
+            for (const auto& generator : aoc::generators()) {
+                if (generator.year == day.year && generator.day == day.day) {
+                    sweepDay(day, generator, options);
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -1,47 +1,45 @@
 /**
  * This is a template for each challenge.
  * 
+ * Copy to src/<year>/<day>/Day<day>.cpp, add a makeDay<day>() declaration
+ * and an entry to the year's days() table.
  **/
-#include <chrono>
-#include <fstream>
-#include <iostream>
 #include <string>
 #include <vector>
 
-int main(int argc, char** argv)
-{
-    auto start = std::chrono::high_resolution_clock::now();
-
-    // Read file
-    std::ifstream inputFile("input.txt");
-    std::string line;
-    auto data = std::make_unique<std::vector<std::string>>();
-    while (std::getline(inputFile, line)) {
-        data->push_back(std::move(line));
-    }
-    inputFile.close();
+#include "Year2020.h"
 
-    auto t1 = std::chrono::high_resolution_clock::now();
+namespace aoc::y2020 {
 
-    // Part 1
-    auto p1Answer = 0;
+namespace {
+
+class DayXX : public Solution
+{
+public:
+    void parse(const Input& input) override
+    {
+        for (auto line : input.lines()) {
+        }
+    }
 
-    auto t2 = std::chrono::high_resolution_clock::now();
+    std::string part1() override
+    {
+        auto p1Answer = 0;
+        return std::to_string(p1Answer);
+    }
 
-    // Part 2
-    auto p2Answer = 0;
+    std::string part2() override
+    {
+        auto p2Answer = 0;
+        return std::to_string(p2Answer);
+    }
+};
 
-    auto t3 = std::chrono::high_resolution_clock::now();
+}
 
-    auto fileLoad = std::chrono::duration_cast<std::chrono::microseconds>(t1 - start).count();
-    auto p1duration = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
-    auto p2duration = std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count();
-    auto totalTime = std::chrono::duration_cast<std::chrono::microseconds>(t3 - start).count();
+std::unique_ptr<Solution> makeDayXX()
+{
+    return std::make_unique<DayXX>();
+}
 
-    std::cout
-        << std::endl
-        << "File Load: " << fileLoad << "us" << std::endl
-        << "Part1: " << p1Answer << " (" << p1duration << "us)" << std::endl
-        << "Part2: " << p2Answer << " (" << p2duration << "us)" << std::endl
-        << "Total Time: " << totalTime << "us" << std::endl;
-}
\ No newline at end of file
+}